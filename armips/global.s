@@ -33,6 +33,7 @@
 .include "armips/data/hiddenabilities.s" // the hidden ability list, 7
 .include "armips/data/baseexp.s" // the base experience list, 8
 //.include "armips/data/monoverworlds.s" // built unconditionally in makefile, 9 includes the max amount of forms per mon not including gender differences
+// scripts/evo_index.py builds the evolution index, 10, from the assembled evolution data
 
 /*
 CURRENT SYNTHETIC NARC ARMIPS USAGE - starting at START_ADDRESS (armips/include/config.s), sequentially
@@ -28,34 +28,32 @@ POKEGRA_NORMAL_PALS := $(patsubst $(POKEGRA_SPRITES_DIR)/%/female/back.png,$(POK
 POKEGRA_SHINY_PALS := $(patsubst $(POKEGRA_SPRITES_DIR)/%/female/back.png,$(POKEGRA_BUILD_DIR)/%-05.NCLR,$(POKEGRA_FEMALE_BACK_FILES))
 
 
-$(POKEGRA_BUILD_DIR)/%-00.NCGR:$(POKEGRA_SPRITES_DIR)/%/female/back.png
-	$(GFX) $< $@ $(POKEGRA_GFX_FLAGS_SPRITE)
-
-$(POKEGRA_BUILD_DIR)/%-01.NCGR:$(POKEGRA_SPRITES_DIR)/%/male/back.png
-	$(GFX) $< $@ $(POKEGRA_GFX_FLAGS_SPRITE)
-
-$(POKEGRA_BUILD_DIR)/%-02.NCGR:$(POKEGRA_SPRITES_DIR)/%/female/front.png
-	$(GFX) $< $@ $(POKEGRA_GFX_FLAGS_SPRITE)
-
-$(POKEGRA_BUILD_DIR)/%-03.NCGR:$(POKEGRA_SPRITES_DIR)/%/male/front.png
-	$(GFX) $< $@ $(POKEGRA_GFX_FLAGS_SPRITE)
-
-$(POKEGRA_BUILD_DIR)/%-04.NCLR:$(POKEGRA_SPRITES_DIR)/%/male/front.png
-	if test -s $<; then \
-		$(GFX) $< $@ $(POKEGRA_GFX_FLAGS_PAL); \
-	elif test -s $(patsubst $(POKEGRA_SPRITES_DIR)/%/male/front.png,$(POKEGRA_SPRITES_DIR)/%/female/front.png,$<); then \
-		$(GFX) $(patsubst $(POKEGRA_SPRITES_DIR)/%/male/front.png,$(POKEGRA_SPRITES_DIR)/%/female/front.png,$<) $@ $(POKEGRA_GFX_FLAGS_PAL); \
-	fi
-
-$(POKEGRA_BUILD_DIR)/%-05.NCLR:$(POKEGRA_SPRITES_DIR)/%/male/back.png
-	if test -s $<; then \
-		$(GFX) $< $@ $(POKEGRA_GFX_FLAGS_PAL); \
-	elif test -s $(patsubst $(POKEGRA_SPRITES_DIR)/%/male/back.png,$(POKEGRA_SPRITES_DIR)/%/female/back.png,$<); then \
-		$(GFX) $(patsubst $(POKEGRA_SPRITES_DIR)/%/male/back.png,$(POKEGRA_SPRITES_DIR)/%/female/back.png,$<) $@ $(POKEGRA_GFX_FLAGS_PAL); \
-	fi
-
-
-$(POKEGRA_NARC): $(POKEGRA_FEMALE_BACK_OBJS) $(POKEGRA_MALE_BACK_OBJS) $(POKEGRA_FEMALE_FRONT_OBJS) $(POKEGRA_MALE_FRONT_OBJS) $(POKEGRA_NORMAL_PALS) $(POKEGRA_SHINY_PALS)
-	$(NARCHIVE) create $@ $(POKEGRA_BUILD_DIR) -nf
+POKEGRA_PNG_FILES := $(POKEGRA_FEMALE_BACK_FILES) $(POKEGRA_MALE_BACK_FILES) $(POKEGRA_FEMALE_FRONT_FILES) $(POKEGRA_MALE_FRONT_FILES)
+POKEGRA_MANIFEST := $(BUILD)/pokegra_manifest.txt
+
+# every species folder with a changed png gets all of its sprites and palettes
+# listed in one manifest, which a single nitrogfx process then converts.
+# palettes come from male/ if it is nonempty, otherwise from female/
+POKEGRA_CHANGED_MONS = $(sort $(notdir $(patsubst %/,%,$(dir $(patsubst %/,%,$(dir $(filter %.png,$?)))))))
+
+$(POKEGRA_NARC): $(POKEGRA_PNG_FILES)
+	mkdir -p $(POKEGRA_BUILD_DIR)
+	: > $(POKEGRA_MANIFEST)
+	for mon in $(POKEGRA_CHANGED_MONS); do \
+		src=$(POKEGRA_SPRITES_DIR)/$$mon; \
+		dst=$(POKEGRA_BUILD_DIR)/$$mon; \
+		if test -e $$src/female/back.png; then echo "$$src/female/back.png $$dst-00.NCGR $(POKEGRA_GFX_FLAGS_SPRITE)" >> $(POKEGRA_MANIFEST); fi; \
+		if test -e $$src/male/back.png; then echo "$$src/male/back.png $$dst-01.NCGR $(POKEGRA_GFX_FLAGS_SPRITE)" >> $(POKEGRA_MANIFEST); fi; \
+		if test -e $$src/female/front.png; then echo "$$src/female/front.png $$dst-02.NCGR $(POKEGRA_GFX_FLAGS_SPRITE)" >> $(POKEGRA_MANIFEST); fi; \
+		if test -e $$src/male/front.png; then echo "$$src/male/front.png $$dst-03.NCGR $(POKEGRA_GFX_FLAGS_SPRITE)" >> $(POKEGRA_MANIFEST); fi; \
+		if test -e $$src/female/back.png; then \
+			if test -s $$src/male/front.png; then echo "$$src/male/front.png $$dst-04.NCLR $(POKEGRA_GFX_FLAGS_PAL)" >> $(POKEGRA_MANIFEST); \
+			elif test -s $$src/female/front.png; then echo "$$src/female/front.png $$dst-04.NCLR $(POKEGRA_GFX_FLAGS_PAL)" >> $(POKEGRA_MANIFEST); fi; \
+			if test -s $$src/male/back.png; then echo "$$src/male/back.png $$dst-05.NCLR $(POKEGRA_GFX_FLAGS_PAL)" >> $(POKEGRA_MANIFEST); \
+			elif test -s $$src/female/back.png; then echo "$$src/female/back.png $$dst-05.NCLR $(POKEGRA_GFX_FLAGS_PAL)" >> $(POKEGRA_MANIFEST); fi; \
+		fi; \
+	done
+	$(GFX) -batch $(POKEGRA_MANIFEST)
+	$(NARCHIVE) update $@ $(POKEGRA_BUILD_DIR) -nf
 
 NARC_FILES += $(POKEGRA_NARC)
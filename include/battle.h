@@ -30,6 +30,8 @@
 #define TYPE_DRAGON   0x10
 #define TYPE_DARK     0x11
 
+#define NUM_TYPES     (TYPE_DARK + 1)
+
 #define SELECT_FIGHT_COMMAND 1
 #define SELECT_ITEM_COMMAND 2
 #define SELECT_POKEMON_COMMAND 3
@@ -706,6 +708,33 @@ struct __attribute__((packed)) BattlePokemon
     /* 0x8c */ struct __attribute__((packed)) battle_moveflag moveeffect;
 }; // size = 0xc0
 
+/**
+ *  @brief what the damage, speed and critical hit calculators read about a battler, gathered in one pass over its
+ *         BattlePokemon by FillBattlerCalcSnapshot instead of a BattlePokemonParamGet call per field
+ */
+struct __attribute__((packed)) BattlerCalcSnapshot
+{
+    u16 species;
+    s16 hp;
+    u16 maxhp;
+    u16 attack;                 /**< raw attack stat */
+    u16 defense;                /**< raw defense stat */
+    u16 speed;                  /**< raw speed stat */
+    u16 spatk;                  /**< raw special attack stat */
+    u16 spdef;                  /**< raw special defense stat */
+    s8 states[STAT_MAX];        /**< stat stages, 6 is neutral */
+    u8 level;
+    u8 sex;
+    u8 type1;
+    u8 type2;
+    u16 ability;                /**< ability from GetBattlerAbility, so 0 under gastro acid */
+    u16 item;                   /**< item from GetBattleMonItem, so 0 if it can't be used right now */
+    int item_held_effect;       /**< hold effect of item */
+    int item_power;             /**< hold effect parameter of item */
+    u32 condition;              /**< STATUS_* flags */
+    u32 condition2;             /**< STATUS2_* flags */
+};
+
 typedef struct {
     u32 alloc_size;
     u32 alloc_ofs;
@@ -828,6 +857,120 @@ struct __attribute__((packed)) BattleAIWorkTable
 };
 
 
+// words in BattleStruct's SkillSeqWork, the largest battle script that can be loaded
+#define BATTLE_SCRIPT_MAX_WORDS (600)
+
+// battle scripts kept in ram by the battle script cache.  the cache is part of the BattleStruct allocation from the
+// battle heap, so it only has room for the subscripts warmed at the start of the battle and the move being used
+#define BATTLE_SCRIPT_CACHE_SLOTS (6)
+
+// words in a battle script cache slot.  the subscripts that run every turn are 7 to 65 words, and all but 46 of the
+// 345 subscripts, 3 of the 294 move effect scripts and none of the move scripts fit.  longer scripts are read from
+// the file system every time, the way all of them were before the cache
+#define BATTLE_SCRIPT_CACHE_SLOT_WORDS (72)
+
+/**
+ *  @brief one battle script held by the battle script cache
+ */
+struct __attribute__((packed)) BattleScriptCacheSlot
+{
+    u16 kind;       /**< ARC_* constant the script was loaded from */
+    u16 index;      /**< file in that narc */
+    u32 last_use;   /**< cache clock at the last lookup that used this slot, 0 if the slot is empty */
+    u32 words;      /**< script length, not counting trailing zero words */
+    int script[BATTLE_SCRIPT_CACHE_SLOT_WORDS];
+};
+
+/**
+ *  @brief least recently used cache of battle scripts, so that pushing and returning from subscripts doesn't hit the
+ *         file system every time.  lives in the BattleStruct, so it is cleared when a battle starts and freed with it
+ */
+struct __attribute__((packed)) BattleScriptCache
+{
+    u32 clock;
+    u32 hits;
+    u32 misses;
+    u32 oversized;  /**< misses for scripts too long for a slot */
+    u32 bytes_read; /**< bytes read from the file system on misses, not counting trailing zero words */
+    struct BattleScriptCacheSlot slot[BATTLE_SCRIPT_CACHE_SLOTS];
+};
+
+
+/**
+ *  @brief the type matchup of one of an AI battler's moves against one target, as AITypeCalc works it out.  the
+ *         AITypeCalc arguments it was worked out for are kept with it, so a lookup with different ones misses
+ */
+struct AIMoveScore
+{
+    u32 flags;          /**< MOVE_STATUS_FLAG_* effectiveness flags AITypeCalc sets when it starts from 0 */
+    u16 atk_ability;
+    u16 def_ability;
+    u16 held_effect;
+    u16 current_move;   /**< sp->current_move_index, which GetAdjustedMoveTypeBasics reads */
+    u8 effectiveness;   /**< damage multiplier in quarters:  0 immune, 2 not very effective, 4 neutral, 8 super effective */
+    u8 valid;
+    u8 type;
+    u8 type1;
+    u8 type2;
+    u8 gravity;         /**< gravity was up, which grounds levitate and air balloon users */
+    u8 padding[2];
+};
+
+/**
+ *  @brief every move of one AI battler scored by AIEvaluateMoves, one column for each target the AI has asked about
+ *         this turn.  thrown away every turn.  not packed like the BattleStruct around it, AITypeCalc works out flags
+ *         through a u32 *
+ */
+struct AIScoreMatrix
+{
+    int turn;                                   /**< sp->total_turn when the matrix was built */
+    u16 move[4];                                /**< the attacker's moves when the matrix was built */
+    u8 built;
+    u8 targets;                                 /**< 1 << target for each column scored since the matrix was built */
+    u8 padding[2];
+    struct AIMoveScore score[4][CLIENT_MAX];    /**< [move slot][target], the attacker's own column is never valid */
+};
+
+
+// "BSPF", marks the start of the battle script profile so the host tool can find it in a ram dump
+#define BATTLE_SCRIPT_PROFILE_MAGIC (0x46505342)
+
+// opcodes counted by the profiler, the battle script command tables are indexed by a byte
+#define BATTLE_SCRIPT_PROFILE_OPCODES (256)
+
+// script changes kept by the profiler before the oldest ones are overwritten
+#define BATTLE_SCRIPT_TRACE_ENTRIES (256)
+
+/**
+ *  @brief one script change recorded by the battle script profiler
+ */
+struct __attribute__((packed)) BattleScriptTraceEntry
+{
+    u32 cycles;     /**< low 32 bits of BattleScriptProfile's vm_cycles when the script started running */
+    u8 kind;        /**< ARC_* constant the script was loaded from */
+    u8 depth;       /**< push_count, how many scripts are waiting to be returned to */
+    u16 index;      /**< file in that narc */
+    u16 pc;         /**< skill_seq_no the script started running at, nonzero when returning to a pushed script */
+    u16 padding;
+};
+
+/**
+ *  @brief everything the battle script profiler records for one battle.  read by scripts/battle_script_profile.py
+ *         from a ram dump, so keep the two in sync
+ */
+struct __attribute__((packed)) BattleScriptProfile
+{
+    u32 magic;          /**< BATTLE_SCRIPT_PROFILE_MAGIC once the profiler has started */
+    u16 opcodes;        /**< BATTLE_SCRIPT_PROFILE_OPCODES */
+    u16 trace_entries;  /**< BATTLE_SCRIPT_TRACE_ENTRIES */
+    u32 trace_count;    /**< script changes recorded, trace[trace_count % BATTLE_SCRIPT_TRACE_ENTRIES] is the next one written */
+    u64 vm_cycles;      /**< cpu cycles spent running battle script commands */
+    u32 count[BATTLE_SCRIPT_PROFILE_OPCODES];
+    u64 cycles[BATTLE_SCRIPT_PROFILE_OPCODES];
+    struct BattleScriptTraceEntry trace[BATTLE_SCRIPT_TRACE_ENTRIES];
+};
+
+
 /**
  *  @brief the entire battle structure that we are interested in (for the most part)
  *
@@ -1018,7 +1161,9 @@ struct __attribute__((packed)) BattleStruct
     /*0x317E*/ struct BattleMove moveTbl[NUM_OF_MOVES + 1];
     /*0x    */ u32 gainedExperience[6]; // possible experience gained per party member in order to get level scaling done right
     /*0x    */ u32 gainedExperienceShare[6]; // possible experience gained per party member in order to get level scaling done right
-    /*0x    */ int SkillSeqWork[600];
+    /*0x    */ int SkillSeqWork[BATTLE_SCRIPT_MAX_WORDS];
+    /*0x    */ struct BattleScriptCache scriptCache;
+    /*0x    */ ALIGN4 struct AIScoreMatrix aiScoreMatrix[CLIENT_MAX]; // the packed members above leave it at 2 mod 4 otherwise
     /*...*/
 };
 
@@ -1343,6 +1488,21 @@ struct __attribute__((packed)) ENCOUNT_SEND_OUT_MESSAGE_PARAM
 
 extern u8 TypeEffectivenessTable[][3];
 
+// gMoveFlags bits, one per list of moves an ability or effect cares about
+#define MOVE_FLAG_IRON_FIST     (0x0001) // punching moves
+#define MOVE_FLAG_STRONG_JAW    (0x0002) // biting moves
+#define MOVE_FLAG_MEGA_LAUNCHER (0x0004) // pulse and aura moves
+#define MOVE_FLAG_SHARPNESS     (0x0008) // slicing moves
+#define MOVE_FLAG_SOUND         (0x0010) // sound moves, turned into water type by liquid voice
+#define MOVE_FLAG_SOUNDPROOF    (0x0020) // sound moves that soundproof blocks
+#define MOVE_FLAG_BULLETPROOF   (0x0040) // ball and bomb moves
+#define MOVE_FLAG_POWDER        (0x0080) // powder moves that grass types are immune to
+#define MOVE_FLAG_TRIAGE        (0x0100) // healing moves that triage gives +3 priority
+
+extern const u16 gMoveFlags[NUM_OF_MOVES];
+
+#define MOVE_HAS_FLAG(move, flag) (((u32)(move) < NUM_OF_MOVES) && (gMoveFlags[(move)] & (flag)))
+
 
 
 
@@ -2056,6 +2216,70 @@ void LONG_CALL Link_CheckTimeout(struct BattleStruct *sp);
  */
 u16 GetBattleMonItem(struct BattleStruct *sp, int client_no);
 
+/**
+ *  @brief fill a BattlerCalcSnapshot with a battler's current state.  it is not kept up to date, so fill it again
+ *         after anything that may change the battler
+ *
+ *  @param sp global battle structure
+ *  @param client_no battler to take the snapshot of
+ *  @param snapshot snapshot to fill
+ */
+void FillBattlerCalcSnapshot(struct BattleStruct *sp, int client_no, struct BattlerCalcSnapshot *snapshot);
+
+/**
+ *  @brief calculate overall damage, accounting for critical hits and me first boosts.  result is stored in sp->damage
+ *
+ *  @param bw battle work structure
+ *  @param sp global battle structure
+ */
+void CalcDamageOverall(void *bw, struct BattleStruct *sp);
+
+/**
+ *  @brief do the final 85-100% damage roll to the damage
+ *
+ *  @param bw battle work structure
+ *  @param sp global battle structure
+ *  @param damage unrolled damage
+ *  @return adjusted damage
+ */
+int AdjustDamageForRoll(void *bw, struct BattleStruct *sp, int damage);
+
+
+
+// defined in ai.c
+/**
+ *  @brief set up type calc flags for AI to respect and make decisions based on
+ *
+ *  @param sp global battle structure
+ *  @param move index of the move being used
+ *  @param type move type, 0 for the one in the move data
+ *  @param atkAbility ability of the attacker
+ *  @param defAbility ability of the defender
+ *  @param held_effect held item effect of the defender
+ *  @param type1 primary type of defender
+ *  @param type2 secondary type of defender
+ *  @param flag flags to modify so that the AI knows what decision to make
+ */
+void AITypeCalc(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2, u32 *flag);
+
+/**
+ *  @brief score all of an AI battler's moves against one target in one pass, working the attacker's ability and the
+ *         target's ability and held item out once.  AITypeCalc answers from the result while it lasts
+ *
+ *  @param sp global battle structure
+ *  @param attacker AI battler to score the moves of
+ *  @param defender battler to score them against, sp->aiWorkTable.ai_defence_client
+ *  @return sp->aiScoreMatrix[attacker], with the defender's column filled
+ */
+const struct AIScoreMatrix *AIEvaluateMoves(struct BattleStruct *sp, int attacker, int defender);
+
+/**
+ *  @brief throw away every AIScoreMatrix so the next AI decision scores moves against the battle as it is now
+ *
+ *  @param sp global battle structure
+ */
+void AIClearScoreMatrices(struct BattleStruct *sp);
+
 
 
 // defined in battle_pokemon.c
@@ -2090,6 +2314,17 @@ u32 GetAdjustedMoveType(struct BattleStruct *sp, u32 client, u32 move); // accou
  */
 u32 GetAdjustedMoveTypeBasics(struct BattleStruct *sp, u32 move, u32 ability, u32 type); // AI-specific, client-agnostic
 
+/**
+ *  @brief find the TypeEffectivenessTable rows that apply to a move type against both defending types, in table order
+ *
+ *  @param move_type type of the move being used
+ *  @param type1 primary type of the defender
+ *  @param type2 secondary type of the defender; skipped if it matches type1
+ *  @param foresight TRUE if foresight or scrappy lets the move ignore the entries after 0xFE
+ *  @param rows filled with up to two TypeEffectivenessTable indices, -1 for unused slots
+ */
+void GetTypeEffectivenessRows(u32 move_type, u32 type1, u32 type2, BOOL foresight, int rows[2]);
+
 /**
  *  @brief changes the form of the battler passed in.  updates all of the stats and possibly updates the ability if necessary
  *
@@ -2203,6 +2438,21 @@ void LoadBattleSubSeqScript(struct BattleStruct *sp, int kind, int index);
  */
 void PushAndLoadBattleScript(struct BattleStruct *sp, int kind, int index);
 
+/**
+ *  @brief return from a subscript loaded by PushAndLoadBattleScript, reloading the script that pushed it
+ *
+ *  @param sp global battle structure
+ *  @return TRUE if there was a script to return to, FALSE if the script stack is empty
+ */
+BOOL PopBattleScript(struct BattleStruct *sp);
+
+/**
+ *  @brief load the battle scripts that run nearly every turn into the battle script cache
+ *
+ *  @param sp global battle structure
+ */
+void WarmBattleScriptCache(struct BattleStruct *sp);
+
 /**
  *  @brief check if waitmessage battle script command should end
  *
@@ -2259,6 +2509,19 @@ u32 ServerWazaKoyuuCheck(void *bw, struct BattleStruct *sp);
  */
 u8 CalcSpeed(void *bw, struct BattleStruct *sp, int client1, int client2, int flag);
 
+/**
+ *  @brief roll for a critical hit
+ *
+ *  @param bw battle work structure
+ *  @param sp global battle structure
+ *  @param attacker attacking battler
+ *  @param defender defending battler
+ *  @param critical_count critical hit stages the move itself adds
+ *  @param side_condition side conditions of the defender's side
+ *  @return critical hit multiplier:  1 for no critical hit, 2 for a critical hit, 3 for one boosted by sniper
+ */
+int CalcCritical(void *bw, struct BattleStruct *sp, int attacker, int defender, int critical_count, u32 side_condition);
+
 /**
  *  @brief set move status effects for super effective and calculate modified damage
  *
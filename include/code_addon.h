@@ -0,0 +1,15 @@
+#ifndef CODE_ADDON_H
+#define CODE_ADDON_H
+
+#include "types.h"
+
+// in src/code_addon.c
+/**
+ *  @brief get the contents of an ARC_CODE_ADDONS file, loading it into its bss buffer the first time it is asked for
+ *
+ *  @param file CODE_ADDON_BASE_EXPERIENCE_LIST or CODE_ADDON_NUM_OF_OW_FORMS_PER_MON
+ *  @return pointer to the file contents, which stay loaded for the rest of the game
+ */
+void *GetCodeAddonData(u32 file);
+
+#endif // CODE_ADDON_H
@@ -39,6 +39,8 @@
 #define CODE_ADDON_HIDDEN_ABILITY_LIST 7
 #define CODE_ADDON_BASE_EXPERIENCE_LIST 8
 #define CODE_ADDON_NUM_OF_OW_FORMS_PER_MON 9
+#define CODE_ADDON_EVOLUTION_INDEX 10
+#define NUM_OF_CODE_ADDONS (CODE_ADDON_EVOLUTION_INDEX + 1)
 
 //a018 file indices for mega stuff
 #define MEGA_ICON_FIGHT_GFX (797)
@@ -23,6 +23,14 @@
 // DEBUG_BATTLE_SCRIPT_COMMANDS prints out the battle script command names in the desmume window
 //#define DEBUG_BATTLE_SCRIPT_COMMANDS
 
+// DEBUG_BATTLE_SCRIPT_CACHE prints the battle script cache's hit and miss counts in the desmume window on every miss,
+// and the BattleStruct size and the room left in the battle heap when a battle starts
+//#define DEBUG_BATTLE_SCRIPT_CACHE
+
+// DEBUG_BATTLE_SCRIPT_PROFILER counts battle script commands and their cpu cycles and records which scripts ran.
+// uses hardware timers 2 and 3.  dump main ram from the emulator during the battle and run scripts/battle_script_profile.py on it
+//#define DEBUG_BATTLE_SCRIPT_PROFILER
+
 // DEBUG_PRINT_OVERLAY_LOADS prints out overlay loads and unloads in the desmume window
 //#define DEBUG_PRINT_OVERLAY_LOADS
 
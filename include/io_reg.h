@@ -12,397 +12,397 @@
 
 #define REG_TM0CNT_L_OFFSET        0x100
 #define REG_TM0CNT_L_ADDR          (HW_REG_BASE + REG_TM0CNT_L_OFFSET)
-#define reg_OS_TM0CNT_L            (*(u16 *)REG_TM0CNT_L_ADDR)
+#define reg_OS_TM0CNT_L            (*(volatile u16 *)REG_TM0CNT_L_ADDR)
 
 #define REG_TM0CNT_H_OFFSET        0x102
 #define REG_TM0CNT_H_ADDR          (HW_REG_BASE + REG_TM0CNT_H_OFFSET)
-#define reg_OS_TM0CNT_H            (*(u16 *)REG_TM0CNT_H_ADDR)
+#define reg_OS_TM0CNT_H            (*(volatile u16 *)REG_TM0CNT_H_ADDR)
 
 #define REG_TM1CNT_L_OFFSET        0x104
 #define REG_TM1CNT_L_ADDR          (HW_REG_BASE + REG_TM1CNT_L_OFFSET)
-#define reg_OS_TM1CNT_L            (*(u16 *)REG_TM1CNT_L_ADDR)
+#define reg_OS_TM1CNT_L            (*(volatile u16 *)REG_TM1CNT_L_ADDR)
 
 #define REG_TM1CNT_H_OFFSET        0x106
 #define REG_TM1CNT_H_ADDR          (HW_REG_BASE + REG_TM1CNT_H_OFFSET)
-#define reg_OS_TM1CNT_H            (*(u16 *)REG_TM1CNT_H_ADDR)
+#define reg_OS_TM1CNT_H            (*(volatile u16 *)REG_TM1CNT_H_ADDR)
 
 #define REG_TM2CNT_L_OFFSET        0x108
 #define REG_TM2CNT_L_ADDR          (HW_REG_BASE + REG_TM2CNT_L_OFFSET)
-#define reg_OS_TM2CNT_L            (*(u16 *)REG_TM2CNT_L_ADDR)
+#define reg_OS_TM2CNT_L            (*(volatile u16 *)REG_TM2CNT_L_ADDR)
 
 #define REG_TM2CNT_H_OFFSET        0x10A
 #define REG_TM2CNT_H_ADDR          (HW_REG_BASE + REG_TM2CNT_H_OFFSET)
-#define reg_OS_TM2CNT_H            (*(u16 *)REG_TM2CNT_H_ADDR)
+#define reg_OS_TM2CNT_H            (*(volatile u16 *)REG_TM2CNT_H_ADDR)
 
 #define REG_TM3CNT_L_OFFSET        0x10C
 #define REG_TM3CNT_L_ADDR          (HW_REG_BASE + REG_TM3CNT_L_OFFSET)
-#define reg_OS_TM3CNT_L            (*(u16 *)REG_TM3CNT_L_ADDR)
+#define reg_OS_TM3CNT_L            (*(volatile u16 *)REG_TM3CNT_L_ADDR)
 
 #define REG_TM3CNT_H_OFFSET        0x10E
 #define REG_TM3CNT_H_ADDR          (HW_REG_BASE + REG_TM3CNT_H_OFFSET)
-#define reg_OS_TM3CNT_H            (*(u16 *)REG_TM3CNT_H_ADDR)
+#define reg_OS_TM3CNT_H            (*(volatile u16 *)REG_TM3CNT_H_ADDR)
 
 #define REG_IE_OFFSET              0x210
 #define REG_IE_ADDR                (HW_REG_BASE + REG_IE_OFFSET)
-#define reg_OS_IE                  (*(u32 *)REG_IE_ADDR)
+#define reg_OS_IE                  (*(volatile u32 *)REG_IE_ADDR)
 
 #define REG_IME_OFFSET             0x208
 #define REG_IME_ADDR               (HW_REG_BASE + REG_IME_OFFSET)
-#define reg_OS_IME                 (*(u16 *)REG_IME_ADDR)
+#define reg_OS_IME                 (*(volatile u16 *)REG_IME_ADDR)
 
 #define REG_IF_OFFSET              0x214
 #define REG_IF_ADDR                (HW_REG_BASE + REG_IF_OFFSET)
-#define reg_OS_IF                  (*(u32 *)REG_IF_ADDR)
+#define reg_OS_IF                  (*(volatile u32 *)REG_IF_ADDR)
 
 #ifdef SDK_ARM7
 #define REG_MAINPINTF_OFFSET       0x180
 #define REG_MAINPINTF_ADDR         (HW_REG_BASE + REG_MAINPINTF_OFFSET)
-#define reg_OS_MAININTF            (*(u16 *)REG_MAINPINTF_ADDR)
+#define reg_OS_MAININTF            (*(volatile u16 *)REG_MAINPINTF_ADDR)
 #else
 #define REG_SUBINTF_OFFSET         0x180
 #define REG_SUBINTF_ADDR           (HW_REG_BASE + REG_SUBINTF_OFFSET)
-#define reg_OS_SUBINTF             (*(u16 *)REG_SUBINTF_ADDR)
+#define reg_OS_SUBINTF             (*(volatile u16 *)REG_SUBINTF_ADDR)
 #endif //SDK_ARM7
 
 #define REG_OS_TM0CNT_H_PS_SHIFT                           0
 
 #define REG_VCOUNT_OFFSET          0x6
 
-#define reg_GX_DISPCNT             (*(u32 *)0x4000000)
-#define reg_GX_DISPSTAT            (*(u16 *)0x4000004)
-#define reg_GX_VCOUNT              (*(u16 *)(HW_REG_BASE + REG_VCOUNT_OFFSET))
-
-#define reg_G2_BG0CNT              (*(u16 *)0x4000008)
-#define reg_G2_BG1CNT              (*(u16 *)0x400000a)
-#define reg_G2_BG2CNT              (*(u16 *)0x400000c)
-#define reg_G2_BG3CNT              (*(u16 *)0x400000e)
-#define reg_G2_BG0OFS              (*(u32 *)0x4000010)
-#define reg_G2_BG0HOFS             (*(u16 *)0x4000010)
-#define reg_G2_BG0VOFS             (*(u16 *)0x4000012)
-#define reg_G2_BG1OFS              (*(u32 *)0x4000014)
-#define reg_G2_BG1HOFS             (*(u16 *)0x4000014)
-#define reg_G2_BG1VOFS             (*(u16 *)0x4000016)
-#define reg_G2_BG2OFS              (*(u32 *)0x4000018)
-#define reg_G2_BG2HOFS             (*(u16 *)0x4000018)
-#define reg_G2_BG2VOFS             (*(u16 *)0x400001a)
-#define reg_G2_BG3OFS              (*(u32 *)0x400001c)
-#define reg_G2_BG3HOFS             (*(u16 *)0x400001c)
-#define reg_G2_BG3VOFS             (*(u16 *)0x400001e)
-#define reg_G2_BG2PA               (*(u16 *)0x4000020)
-#define reg_G2_BG2PB               (*(u16 *)0x4000022)
-#define reg_G2_BG2PC               (*(u16 *)0x4000024)
-#define reg_G2_BG2PD               (*(u16 *)0x4000026)
-#define reg_G2_BG2X                (*(u32 *)0x4000028)
-#define reg_G2_BG2Y                (*(u32 *)0x400002c)
-#define reg_G2_BG3PA               (*(u16 *)0x4000030)
-#define reg_G2_BG3PB               (*(u16 *)0x4000032)
-#define reg_G2_BG3PC               (*(u16 *)0x4000034)
-#define reg_G2_BG3PD               (*(u16 *)0x4000036)
-#define reg_G2_BG3X                (*(u32 *)0x4000038)
-#define reg_G2_BG3Y                (*(u32 *)0x400003c)
-#define reg_G2_WIN0H               (*(u16 *)0x4000040)
-#define reg_G2_WIN1H               (*(u16 *)0x4000042)
-#define reg_G2_WIN0V               (*(u16 *)0x4000044)
-#define reg_G2_WIN1V               (*(u16 *)0x4000046)
-#define reg_G2_WININ               (*(u16 *)0x4000048)
-#define reg_G2_WINOUT              (*(u16 *)0x400004a)
-#define reg_G2_MOSAIC              (*(u16 *)0x400004c)
-#define reg_G2_BLDCNT              (*(u16 *)0x4000050)
-#define reg_G2_BLDALPHA            (*(u16 *)0x4000052)
-#define reg_G2_BLDY                (*(u16 *)0x4000054)
-
-#define reg_G3X_DISP3DCNT          (*(u16 *)0x4000060)
-
-#define reg_GX_DISPCAPCNT          (*(u32 *)0x4000064)
-#define reg_GX_DISP_MMEM_FIFO      (*(u32 *)0x4000068)
-#define reg_GX_DISP_MMEM_FIFO_L    (*(u16 *)0x4000068)
-#define reg_GX_DISP_MMEM_FIFO_H    (*(u16 *)0x400006a)
-#define reg_GX_MASTER_BRIGHT       (*(u16 *)0x400006c)
-#define reg_GX_TVOUTCNT            (*(u16 *)0x4000070)
-
-#define reg_MI_DMA0SAD             (*(u32 *)0x40000b0)
-#define reg_MI_DMA0DAD             (*(u32 *)0x40000b4)
-#define reg_MI_DMA0CNT             (*(u32 *)0x40000b8)
-#define reg_MI_DMA1SAD             (*(u32 *)0x40000bc)
-#define reg_MI_DMA1DAD             (*(u32 *)0x40000c0)
-#define reg_MI_DMA1CNT             (*(u32 *)0x40000c4)
-#define reg_MI_DMA2SAD             (*(u32 *)0x40000c8)
-#define reg_MI_DMA2DAD             (*(u32 *)0x40000cc)
-#define reg_MI_DMA2CNT             (*(u32 *)0x40000d0)
-#define reg_MI_DMA3SAD             (*(u32 *)0x40000d4)
-#define reg_MI_DMA3DAD             (*(u32 *)0x40000d8)
-#define reg_MI_DMA3CNT             (*(u32 *)0x40000dc)
-#define reg_MI_DMA0_CLR_DATA       (*(u32 *)0x40000e0)
-#define reg_MI_DMA1_CLR_DATA       (*(u32 *)0x40000e4)
-#define reg_MI_DMA2_CLR_DATA       (*(u32 *)0x40000e8)
-#define reg_MI_DMA3_CLR_DATA       (*(u32 *)0x40000ec)
-
-#define reg_EXI_SIODATA32          (*(u32 *)0x4000120)
-#define reg_EXI_SIOCNT             (*(u16 *)0x4000128)
-#define reg_EXI_SIOSEL             (*(u32 *)0x400012c)
-
-#define reg_PAD_KEYINPUT           (*(u16 *)0x4000130)
-#define reg_PAD_KEYCNT             (*(u16 *)0x4000132)
-
-#define reg_MI_MCCNT0              (*(u16 *)0x40001a0)
-#define reg_CARD_MASTERCNT         (*(u8  *)0x40001a1) //?
-#define reg_MI_MCD0                (*(u16 *)0x40001a2)
-#define reg_MI_MCCNT1              (*(u32 *)0x40001a4)
-#define reg_CARD_CNT               (*(u32 *)0x40001a4) //?
-#define reg_MI_MCCMD0              (*(u32 *)0x40001a8)
-#define reg_CARD_CMD               (*(u8  *)0x40001a8) //?
-#define reg_MI_MCCMD1              (*(u32 *)0x40001ac)
-#define reg_MI_EXMEMCNT            (*(u16 *)0x4000204)
-
-#define reg_OS_PAUSE               (*(u16 *)0x4000300)
-
-#define reg_GX_VRAMCNT             (*(u32 *)0x4000240)
-#define reg_GX_VRAMCNT_A           (*(u8  *)0x4000240)
-#define reg_GX_VRAMCNT_B           (*(u8  *)0x4000241)
-#define reg_GX_VRAMCNT_C           (*(u8  *)0x4000242)
-#define reg_GX_VRAMCNT_D           (*(u8  *)0x4000243)
-#define reg_GX_WVRAMCNT            (*(u32 *)0x4000244)
-#define reg_GX_VRAMCNT_E           (*(u8  *)0x4000244)
-#define reg_GX_VRAMCNT_F           (*(u8  *)0x4000245)
-#define reg_GX_VRAMCNT_G           (*(u8  *)0x4000246)
-#define reg_GX_VRAMCNT_WRAM        (*(u8  *)0x4000247)
-#define reg_GX_VRAM_HI_CNT         (*(u16 *)0x4000248)
-#define reg_GX_VRAMCNT_H           (*(u8  *)0x4000248)
-#define reg_GX_VRAMCNT_I           (*(u8  *)0x4000249)
-
-#define reg_CP_DIVCNT              (*(u16 *)0x4000280)
+#define reg_GX_DISPCNT             (*(volatile u32 *)0x4000000)
+#define reg_GX_DISPSTAT            (*(volatile u16 *)0x4000004)
+#define reg_GX_VCOUNT              (*(volatile u16 *)(HW_REG_BASE + REG_VCOUNT_OFFSET))
+
+#define reg_G2_BG0CNT              (*(volatile u16 *)0x4000008)
+#define reg_G2_BG1CNT              (*(volatile u16 *)0x400000a)
+#define reg_G2_BG2CNT              (*(volatile u16 *)0x400000c)
+#define reg_G2_BG3CNT              (*(volatile u16 *)0x400000e)
+#define reg_G2_BG0OFS              (*(volatile u32 *)0x4000010)
+#define reg_G2_BG0HOFS             (*(volatile u16 *)0x4000010)
+#define reg_G2_BG0VOFS             (*(volatile u16 *)0x4000012)
+#define reg_G2_BG1OFS              (*(volatile u32 *)0x4000014)
+#define reg_G2_BG1HOFS             (*(volatile u16 *)0x4000014)
+#define reg_G2_BG1VOFS             (*(volatile u16 *)0x4000016)
+#define reg_G2_BG2OFS              (*(volatile u32 *)0x4000018)
+#define reg_G2_BG2HOFS             (*(volatile u16 *)0x4000018)
+#define reg_G2_BG2VOFS             (*(volatile u16 *)0x400001a)
+#define reg_G2_BG3OFS              (*(volatile u32 *)0x400001c)
+#define reg_G2_BG3HOFS             (*(volatile u16 *)0x400001c)
+#define reg_G2_BG3VOFS             (*(volatile u16 *)0x400001e)
+#define reg_G2_BG2PA               (*(volatile u16 *)0x4000020)
+#define reg_G2_BG2PB               (*(volatile u16 *)0x4000022)
+#define reg_G2_BG2PC               (*(volatile u16 *)0x4000024)
+#define reg_G2_BG2PD               (*(volatile u16 *)0x4000026)
+#define reg_G2_BG2X                (*(volatile u32 *)0x4000028)
+#define reg_G2_BG2Y                (*(volatile u32 *)0x400002c)
+#define reg_G2_BG3PA               (*(volatile u16 *)0x4000030)
+#define reg_G2_BG3PB               (*(volatile u16 *)0x4000032)
+#define reg_G2_BG3PC               (*(volatile u16 *)0x4000034)
+#define reg_G2_BG3PD               (*(volatile u16 *)0x4000036)
+#define reg_G2_BG3X                (*(volatile u32 *)0x4000038)
+#define reg_G2_BG3Y                (*(volatile u32 *)0x400003c)
+#define reg_G2_WIN0H               (*(volatile u16 *)0x4000040)
+#define reg_G2_WIN1H               (*(volatile u16 *)0x4000042)
+#define reg_G2_WIN0V               (*(volatile u16 *)0x4000044)
+#define reg_G2_WIN1V               (*(volatile u16 *)0x4000046)
+#define reg_G2_WININ               (*(volatile u16 *)0x4000048)
+#define reg_G2_WINOUT              (*(volatile u16 *)0x400004a)
+#define reg_G2_MOSAIC              (*(volatile u16 *)0x400004c)
+#define reg_G2_BLDCNT              (*(volatile u16 *)0x4000050)
+#define reg_G2_BLDALPHA            (*(volatile u16 *)0x4000052)
+#define reg_G2_BLDY                (*(volatile u16 *)0x4000054)
+
+#define reg_G3X_DISP3DCNT          (*(volatile u16 *)0x4000060)
+
+#define reg_GX_DISPCAPCNT          (*(volatile u32 *)0x4000064)
+#define reg_GX_DISP_MMEM_FIFO      (*(volatile u32 *)0x4000068)
+#define reg_GX_DISP_MMEM_FIFO_L    (*(volatile u16 *)0x4000068)
+#define reg_GX_DISP_MMEM_FIFO_H    (*(volatile u16 *)0x400006a)
+#define reg_GX_MASTER_BRIGHT       (*(volatile u16 *)0x400006c)
+#define reg_GX_TVOUTCNT            (*(volatile u16 *)0x4000070)
+
+#define reg_MI_DMA0SAD             (*(volatile u32 *)0x40000b0)
+#define reg_MI_DMA0DAD             (*(volatile u32 *)0x40000b4)
+#define reg_MI_DMA0CNT             (*(volatile u32 *)0x40000b8)
+#define reg_MI_DMA1SAD             (*(volatile u32 *)0x40000bc)
+#define reg_MI_DMA1DAD             (*(volatile u32 *)0x40000c0)
+#define reg_MI_DMA1CNT             (*(volatile u32 *)0x40000c4)
+#define reg_MI_DMA2SAD             (*(volatile u32 *)0x40000c8)
+#define reg_MI_DMA2DAD             (*(volatile u32 *)0x40000cc)
+#define reg_MI_DMA2CNT             (*(volatile u32 *)0x40000d0)
+#define reg_MI_DMA3SAD             (*(volatile u32 *)0x40000d4)
+#define reg_MI_DMA3DAD             (*(volatile u32 *)0x40000d8)
+#define reg_MI_DMA3CNT             (*(volatile u32 *)0x40000dc)
+#define reg_MI_DMA0_CLR_DATA       (*(volatile u32 *)0x40000e0)
+#define reg_MI_DMA1_CLR_DATA       (*(volatile u32 *)0x40000e4)
+#define reg_MI_DMA2_CLR_DATA       (*(volatile u32 *)0x40000e8)
+#define reg_MI_DMA3_CLR_DATA       (*(volatile u32 *)0x40000ec)
+
+#define reg_EXI_SIODATA32          (*(volatile u32 *)0x4000120)
+#define reg_EXI_SIOCNT             (*(volatile u16 *)0x4000128)
+#define reg_EXI_SIOSEL             (*(volatile u32 *)0x400012c)
+
+#define reg_PAD_KEYINPUT           (*(volatile u16 *)0x4000130)
+#define reg_PAD_KEYCNT             (*(volatile u16 *)0x4000132)
+
+#define reg_MI_MCCNT0              (*(volatile u16 *)0x40001a0)
+#define reg_CARD_MASTERCNT         (*(volatile u8  *)0x40001a1) //?
+#define reg_MI_MCD0                (*(volatile u16 *)0x40001a2)
+#define reg_MI_MCCNT1              (*(volatile u32 *)0x40001a4)
+#define reg_CARD_CNT               (*(volatile u32 *)0x40001a4) //?
+#define reg_MI_MCCMD0              (*(volatile u32 *)0x40001a8)
+#define reg_CARD_CMD               (*(volatile u8  *)0x40001a8) //?
+#define reg_MI_MCCMD1              (*(volatile u32 *)0x40001ac)
+#define reg_MI_EXMEMCNT            (*(volatile u16 *)0x4000204)
+
+#define reg_OS_PAUSE               (*(volatile u16 *)0x4000300)
+
+#define reg_GX_VRAMCNT             (*(volatile u32 *)0x4000240)
+#define reg_GX_VRAMCNT_A           (*(volatile u8  *)0x4000240)
+#define reg_GX_VRAMCNT_B           (*(volatile u8  *)0x4000241)
+#define reg_GX_VRAMCNT_C           (*(volatile u8  *)0x4000242)
+#define reg_GX_VRAMCNT_D           (*(volatile u8  *)0x4000243)
+#define reg_GX_WVRAMCNT            (*(volatile u32 *)0x4000244)
+#define reg_GX_VRAMCNT_E           (*(volatile u8  *)0x4000244)
+#define reg_GX_VRAMCNT_F           (*(volatile u8  *)0x4000245)
+#define reg_GX_VRAMCNT_G           (*(volatile u8  *)0x4000246)
+#define reg_GX_VRAMCNT_WRAM        (*(volatile u8  *)0x4000247)
+#define reg_GX_VRAM_HI_CNT         (*(volatile u16 *)0x4000248)
+#define reg_GX_VRAMCNT_H           (*(volatile u8  *)0x4000248)
+#define reg_GX_VRAMCNT_I           (*(volatile u8  *)0x4000249)
+
+#define reg_CP_DIVCNT              (*(volatile u16 *)0x4000280)
 
 #define REG_DIV_NUMER_ADDR         0x4000290
 #define reg_CP_DIV_NUMER           (*(REGType64v *)REG_DIV_NUMER_ADDR)
-#define reg_CP_DIV_NUMER_L         (*(u32 *)REG_DIV_NUMER_ADDR)
-#define reg_CP_DIV_NUMER_H         (*(u32 *)0x4000294)
+#define reg_CP_DIV_NUMER_L         (*(volatile u32 *)REG_DIV_NUMER_ADDR)
+#define reg_CP_DIV_NUMER_H         (*(volatile u32 *)0x4000294)
 #define reg_CP_DIV_DENOM           (*(REGType64v *)0x4000298)
-#define reg_CP_DIV_DENOM_L         (*(u32 *)0x4000298)
-#define reg_CP_DIV_DENOM_H         (*(u32 *)0x400029c)
+#define reg_CP_DIV_DENOM_L         (*(volatile u32 *)0x4000298)
+#define reg_CP_DIV_DENOM_H         (*(volatile u32 *)0x400029c)
 #define reg_CP_DIV_RESULT          (*(REGType64v *)0x40002A0)
-#define reg_CP_DIV_RESULT_L        (*(u32 *)0x40002A0)
-#define reg_CP_DIV_RESULT_H        (*(u32 *)0x40002A4)
+#define reg_CP_DIV_RESULT_L        (*(volatile u32 *)0x40002A0)
+#define reg_CP_DIV_RESULT_H        (*(volatile u32 *)0x40002A4)
 #define reg_CP_DIVREM_RESULT       (*(REGType64v *)0x40002A8)
-#define reg_CP_DIVREM_RESULT_L     (*(u32 *)0x40002A8)
-#define reg_CP_DIVREM_RESULT_H     (*(u32 *)0x40002Ac)
-#define reg_CP_SQRTCNT             (*(u16 *)0x40002B0)
-#define reg_CP_SQRT_RESULT         (*(u32 *)0x40002B4)
+#define reg_CP_DIVREM_RESULT_L     (*(volatile u32 *)0x40002A8)
+#define reg_CP_DIVREM_RESULT_H     (*(volatile u32 *)0x40002Ac)
+#define reg_CP_SQRTCNT             (*(volatile u16 *)0x40002B0)
+#define reg_CP_SQRT_RESULT         (*(volatile u32 *)0x40002B4)
 #define reg_CP_SQRT_PARAM          (*(REGType64v *)0x40002B8)
-#define reg_CP_SQRT_PARAM_L        (*(u32 *)0x40002B8)
-#define reg_CP_SQRT_PARAM_H        (*(u32 *)0x40002Bc)
-
-#define reg_GX_POWCNT              (*(u16 *)0x4000304)
-
-#define reg_G3X_RDLINES_COUNT      (*(const u16 *)0x4000320)
-#define reg_G3X_EDGE_COLOR_0       (*(u32 *)0x4000330)
-#define reg_G3X_EDGE_COLOR_0_L     (*(u16 *)0x4000330)
-#define reg_G3X_EDGE_COLOR_0_H     (*(u16 *)0x4000332)
-#define reg_G3X_EDGE_COLOR_1       (*(u32 *)0x4000334)
-#define reg_G3X_EDGE_COLOR_1_L     (*(u16 *)0x4000334)
-#define reg_G3X_EDGE_COLOR_1_H     (*(u16 *)0x4000336)
-#define reg_G3X_EDGE_COLOR_2       (*(u32 *)0x4000338)
-#define reg_G3X_EDGE_COLOR_2_L     (*(u16 *)0x4000338)
-#define reg_G3X_EDGE_COLOR_2_H     (*(u16 *)0x400033a)
-#define reg_G3X_EDGE_COLOR_3       (*(u32 *)0x400033c)
-#define reg_G3X_EDGE_COLOR_3_L     (*(u16 *)0x400033c)
-#define reg_G3X_EDGE_COLOR_3_H     (*(u16 *)0x400033e)
-#define reg_G3X_ALPHA_TEST_REF     (*(u16 *)0x4000340)
-#define reg_G3X_CLEAR_COLOR        (*(u32 *)0x4000350)
-#define reg_G3X_CLEAR_DEPTH        (*(u16 *)0x4000354)
-#define reg_G3X_CLRIMAGE_OFFSET    (*(u16 *)0x4000356)
-#define reg_G3X_FOG_COLOR          (*(u32 *)0x4000358)
-#define reg_G3X_FOG_OFFSET         (*(u16 *)0x400035c)
-#define reg_G3X_FOG_TABLE_0        (*(u32 *)0x4000360)
-#define reg_G3X_FOG_TABLE_0_L      (*(u16 *)0x4000360)
-#define reg_G3X_FOG_TABLE_0_H      (*(u16 *)0x4000362)
-#define reg_G3X_FOG_TABLE_1        (*(u32 *)0x4000364)
-#define reg_G3X_FOG_TABLE_1_L      (*(u16 *)0x4000364)
-#define reg_G3X_FOG_TABLE_1_H      (*(u16 *)0x4000366)
-#define reg_G3X_FOG_TABLE_2        (*(u32 *)0x4000368)
-#define reg_G3X_FOG_TABLE_2_L      (*(u16 *)0x4000368)
-#define reg_G3X_FOG_TABLE_2_H      (*(u16 *)0x400036a)
-#define reg_G3X_FOG_TABLE_3        (*(u32 *)0x400036c)
-#define reg_G3X_FOG_TABLE_3_L      (*(u16 *)0x400036c)
-#define reg_G3X_FOG_TABLE_3_H      (*(u16 *)0x400036e)
-#define reg_G3X_FOG_TABLE_4        (*(u32 *)0x4000370)
-#define reg_G3X_FOG_TABLE_4_L      (*(u16 *)0x4000370)
-#define reg_G3X_FOG_TABLE_4_H      (*(u16 *)0x4000372)
-#define reg_G3X_FOG_TABLE_5        (*(u32 *)0x4000374)
-#define reg_G3X_FOG_TABLE_5_L      (*(u16 *)0x4000374)
-#define reg_G3X_FOG_TABLE_5_H      (*(u16 *)0x4000376)
-#define reg_G3X_FOG_TABLE_6        (*(u32 *)0x4000378)
-#define reg_G3X_FOG_TABLE_6_L      (*(u16 *)0x4000378)
-#define reg_G3X_FOG_TABLE_6_H      (*(u16 *)0x400037a)
-#define reg_G3X_FOG_TABLE_7        (*(u32 *)0x400037c)
-#define reg_G3X_FOG_TABLE_7_L      (*(u16 *)0x400037c)
-#define reg_G3X_FOG_TABLE_7_H      (*(u16 *)0x400037e)
-#define reg_G3X_TOON_TABLE_0       (*(u32 *)0x4000380)
-#define reg_G3X_TOON_TABLE_0_L     (*(u16 *)0x4000380)
-#define reg_G3X_TOON_TABLE_0_H     (*(u16 *)0x4000382)
-#define reg_G3X_TOON_TABLE_1       (*(u32 *)0x4000384)
-#define reg_G3X_TOON_TABLE_1_L     (*(u16 *)0x4000384)
-#define reg_G3X_TOON_TABLE_1_H     (*(u16 *)0x4000386)
-#define reg_G3X_TOON_TABLE_2       (*(u32 *)0x4000388)
-#define reg_G3X_TOON_TABLE_2_L     (*(u16 *)0x4000388)
-#define reg_G3X_TOON_TABLE_2_H     (*(u16 *)0x400038a)
-#define reg_G3X_TOON_TABLE_3       (*(u32 *)0x400038c)
-#define reg_G3X_TOON_TABLE_3_L     (*(u16 *)0x400038c)
-#define reg_G3X_TOON_TABLE_3_H     (*(u16 *)0x400038e)
-#define reg_G3X_TOON_TABLE_4       (*(u32 *)0x4000390)
-#define reg_G3X_TOON_TABLE_4_L     (*(u16 *)0x4000390)
-#define reg_G3X_TOON_TABLE_4_H     (*(u16 *)0x4000392)
-#define reg_G3X_TOON_TABLE_5       (*(u32 *)0x4000394)
-#define reg_G3X_TOON_TABLE_5_L     (*(u16 *)0x4000394)
-#define reg_G3X_TOON_TABLE_5_H     (*(u16 *)0x4000396)
-#define reg_G3X_TOON_TABLE_7       (*(u32 *)0x400039c)
-#define reg_G3X_TOON_TABLE_7_L     (*(u16 *)0x400039c)
-#define reg_G3X_TOON_TABLE_7_H     (*(u16 *)0x400039e)
-#define reg_G3X_TOON_TABLE_8       (*(u32 *)0x40003a0)
-#define reg_G3X_TOON_TABLE_8_L     (*(u16 *)0x40003a0)
-#define reg_G3X_TOON_TABLE_8_H     (*(u16 *)0x40003a2)
-#define reg_G3X_TOON_TABLE_9       (*(u32 *)0x40003a4)
-#define reg_G3X_TOON_TABLE_9_L     (*(u16 *)0x40003a4)
-#define reg_G3X_TOON_TABLE_9_H     (*(u16 *)0x40003a6)
-#define reg_G3X_TOON_TABLE_10      (*(u32 *)0x40003a8)
-#define reg_G3X_TOON_TABLE_10_L    (*(u16 *)0x40003a8)
-#define reg_G3X_TOON_TABLE_10_H    (*(u16 *)0x40003aa)
-#define reg_G3X_TOON_TABLE_11      (*(u32 *)0x40003ac)
-#define reg_G3X_TOON_TABLE_11_L    (*(u16 *)0x40003ac)
-#define reg_G3X_TOON_TABLE_11_H    (*(u16 *)0x40003ae)
-#define reg_G3X_TOON_TABLE_12      (*(u32 *)0x40003b0)
-#define reg_G3X_TOON_TABLE_12_L    (*(u16 *)0x40003b0)
-#define reg_G3X_TOON_TABLE_12_H    (*(u16 *)0x40003b2)
-#define reg_G3X_TOON_TABLE_13      (*(u32 *)0x40003b4)
-#define reg_G3X_TOON_TABLE_13_L    (*(u16 *)0x40003b4)
-#define reg_G3X_TOON_TABLE_13_H    (*(u16 *)0x40003b6)
-#define reg_G3X_TOON_TABLE_14      (*(u32 *)0x40003b8)
-#define reg_G3X_TOON_TABLE_14_L    (*(u16 *)0x40003b8)
-#define reg_G3X_TOON_TABLE_14_H    (*(u16 *)0x40003ba)
-#define reg_G3X_TOON_TABLE_15      (*(u32 *)0x40003bc)
-#define reg_G3X_TOON_TABLE_15_L    (*(u16 *)0x40003bc)
-#define reg_G3X_TOON_TABLE_15_H    (*(u16 *)0x40003be)
-#define reg_G3X_GXFIFO             (*(u32 *)0x4000400)
-
-#define reg_G3_MTX_MODE            (*(u32 *)0x4000440)
-#define reg_G3_MTX_PUSH            (*(u32 *)0x4000444)
-#define reg_G3_MTX_POP             (*(u32 *)0x4000448)
-#define reg_G3_MTX_STORE           (*(u32 *)0x400044c)
-#define reg_G3_MTX_RESTORE         (*(u32 *)0x4000450)
-#define reg_G3_MTX_IDENTITY        (*(u32 *)0x4000454)
-#define reg_G3_MTX_LOAD_4x4        (*(u32 *)0x4000458)
-#define reg_G3_MTX_LOAD_4x3        (*(u32 *)0x400045c)
-#define reg_G3_MTX_MULT_4x4        (*(u32 *)0x4000460)
-#define reg_G3_MTX_MULT_4x3        (*(u32 *)0x4000464)
-#define reg_G3_MTX_MULT_3x3        (*(u32 *)0x4000468)
-#define reg_G3_MTX_SCALE           (*(u32 *)0x400046c)
-#define reg_G3_MTX_TRANS           (*(u32 *)0x4000470)
-#define reg_G3_COLOR               (*(u32 *)0x4000480)
-#define reg_G3_NORMAL              (*(u32 *)0x4000484)
-#define reg_G3_TEXCOORD            (*(u32 *)0x4000488)
-#define reg_G3_VTX_16              (*(u32 *)0x400048c)
-#define reg_G3_VTX_10              (*(u32 *)0x4000490)
-#define reg_G3_VTX_XY              (*(u32 *)0x4000494)
-#define reg_G3_VTX_XZ              (*(u32 *)0x4000498)
-#define reg_G3_VTX_YZ              (*(u32 *)0x400049c)
-#define reg_G3_VTX_DIFF            (*(u32 *)0x40004a0)
-#define reg_G3_POLYGON_ATTR        (*(u32 *)0x40004a4)
-#define reg_G3_TEXIMAGE_PARAM      (*(u32 *)0x40004a8)
-#define reg_G3_TEXPLTT_BASE        (*(u32 *)0x40004ac)
-#define reg_G3_DIF_AMB             (*(u32 *)0x40004c0)
-#define reg_G3_SPE_EMI             (*(u32 *)0x40004c4)
-#define reg_G3_LIGHT_VECTOR        (*(u32 *)0x40004c8)
-#define reg_G3_LIGHT_COLOR         (*(u32 *)0x40004cc)
-#define reg_G3_SHININESS           (*(u32 *)0x40004d0)
-#define reg_G3_BEGIN_VTXS          (*(u32 *)0x4000500)
-#define reg_G3_END_VTXS            (*(u32 *)0x4000504)
-#define reg_G3_SWAP_BUFFERS        (*(u32 *)0x4000540)
-#define reg_G3_VIEWPORT            (*(u32 *)0x4000580)
-#define reg_G3_BOX_TEST            (*(u32 *)0x40005c0)
-#define reg_G3_POS_TEST            (*(u32 *)0x40005c4)
-#define reg_G3_VEC_TEST            (*(u32 *)0x40005c8)
-
-#define reg_G3X_GXSTAT             (*(u32 *)0x4000600)
-#define reg_G3X_LISTRAM_COUNT      (*(u16 *)0x4000604)
-#define reg_G3X_VTXRAM_COUNT       (*(u16 *)0x4000606)
-#define reg_G3X_DISP_1DOT_DEPTH    (*(u16 *)0x4000610)
-#define reg_G3X_POS_RESULT_X       (*(const u32 *)0x4000620)
-#define reg_G3X_POS_RESULT_Y       (*(const u32 *)0x4000624)
-#define reg_G3X_POS_RESULT_Z       (*(const u32 *)0x4000628)
-#define reg_G3X_POS_RESULT_W       (*(const u32 *)0x400062c)
-#define reg_G3X_VEC_RESULT_X       (*(const u16 *)0x4000630)
-#define reg_G3X_VEC_RESULT_Y       (*(const u16 *)0x4000632)
-#define reg_G3X_VEC_RESULT_Z       (*(const u16 *)0x4000634)
-#define reg_G3X_CLIPMTX_RESULT_0   (*(const u32 *)0x4000640)
-#define reg_G3X_CLIPMTX_RESULT_1   (*(const u32 *)0x4000644)
-#define reg_G3X_CLIPMTX_RESULT_2   (*(const u32 *)0x4000648)
-#define reg_G3X_CLIPMTX_RESULT_3   (*(const u32 *)0x400064c)
-#define reg_G3X_CLIPMTX_RESULT_4   (*(const u32 *)0x4000650)
-#define reg_G3X_CLIPMTX_RESULT_5   (*(const u32 *)0x4000654)
-#define reg_G3X_CLIPMTX_RESULT_6   (*(const u32 *)0x4000658)
-#define reg_G3X_CLIPMTX_RESULT_7   (*(const u32 *)0x400065c)
-#define reg_G3X_CLIPMTX_RESULT_8   (*(const u32 *)0x4000660)
-#define reg_G3X_CLIPMTX_RESULT_9   (*(const u32 *)0x4000664)
-#define reg_G3X_CLIPMTX_RESULT_10  (*(const u32 *)0x4000668)
-#define reg_G3X_CLIPMTX_RESULT_11  (*(const u32 *)0x400066c)
-#define reg_G3X_CLIPMTX_RESULT_12  (*(const u32 *)0x4000670)
-#define reg_G3X_CLIPMTX_RESULT_13  (*(const u32 *)0x4000674)
-#define reg_G3X_CLIPMTX_RESULT_14  (*(const u32 *)0x4000678)
-#define reg_G3X_CLIPMTX_RESULT_15  (*(const u32 *)0x400067c)
-#define reg_G3X_VECMTX_RESULT_0    (*(const u32 *)0x4000680)
-#define reg_G3X_VECMTX_RESULT_1    (*(const u32 *)0x4000684)
-#define reg_G3X_VECMTX_RESULT_2    (*(const u32 *)0x4000688)
-#define reg_G3X_VECMTX_RESULT_3    (*(const u32 *)0x400068c)
-#define reg_G3X_VECMTX_RESULT_4    (*(const u32 *)0x4000690)
-#define reg_G3X_VECMTX_RESULT_5    (*(const u32 *)0x4000694)
-#define reg_G3X_VECMTX_RESULT_6    (*(const u32 *)0x4000698)
-#define reg_G3X_VECMTX_RESULT_7    (*(const u32 *)0x400069c)
-#define reg_G3X_VECMTX_RESULT_8    (*(const u32 *)0x40006a0)
-
-#define reg_GXS_DB_DISPCNT         (*(u32 *)0x4001000)
-
-#define reg_G2S_DB_BG0CNT          (*(u16 *)0x4001008)
-#define reg_G2S_DB_BG1CNT          (*(u16 *)0x400100a)
-#define reg_G2S_DB_BG2CNT          (*(u16 *)0x400100c)
-#define reg_G2S_DB_BG3CNT          (*(u16 *)0x400100e)
-#define reg_G2S_DB_BG0OFS          (*(u32 *)0x4001010)
-#define reg_G2S_DB_BG0HOFS         (*(u16 *)0x4001010)
-#define reg_G2S_DB_BG0VOFS         (*(u16 *)0x4001012)
-#define reg_G2S_DB_BG1OFS          (*(u32 *)0x4001014)
-#define reg_G2S_DB_BG1HOFS         (*(u16 *)0x4001014)
-#define reg_G2S_DB_BG1VOFS         (*(u16 *)0x4001016)
-#define reg_G2S_DB_BG2OFS          (*(u32 *)0x4001018)
-#define reg_G2S_DB_BG2HOFS         (*(u16 *)0x4001018)
-#define reg_G2S_DB_BG2VOFS         (*(u16 *)0x400101a)
-#define reg_G2S_DB_BG3OFS          (*(u32 *)0x400101c)
-#define reg_G2S_DB_BG3HOFS         (*(u16 *)0x400101c)
-#define reg_G2S_DB_BG3VOFS         (*(u16 *)0x400101e)
-#define reg_G2S_DB_BG2PA           (*(u16 *)0x4001020)
-#define reg_G2S_DB_BG2PB           (*(u16 *)0x4001022)
-#define reg_G2S_DB_BG2PC           (*(u16 *)0x4001024)
-#define reg_G2S_DB_BG2PD           (*(u16 *)0x4001026)
-#define reg_G2S_DB_BG2X            (*(u32 *)0x4001028)
-#define reg_G2S_DB_BG2Y            (*(u32 *)0x400102c)
-#define reg_G2S_DB_BG3PA           (*(u16 *)0x4001030)
-#define reg_G2S_DB_BG3PB           (*(u16 *)0x4001032)
-#define reg_G2S_DB_BG3PC           (*(u16 *)0x4001034)
-#define reg_G2S_DB_BG3PD           (*(u16 *)0x4001036)
-#define reg_G2S_DB_BG3X            (*(u32 *)0x4001038)
-#define reg_G2S_DB_BG3Y            (*(u32 *)0x400103c)
-#define reg_G2S_DB_WIN0H           (*(u16 *)0x4001040)
-#define reg_G2S_DB_WIN1H           (*(u16 *)0x4001042)
-#define reg_G2S_DB_WIN0V           (*(u16 *)0x4001044)
-#define reg_G2S_DB_WIN1V           (*(u16 *)0x4001046)
-#define reg_G2S_DB_WININ           (*(u16 *)0x4001048)
-#define reg_G2S_DB_WINOUT          (*(u16 *)0x400104a)
-#define reg_G2S_DB_MOSAIC          (*(u16 *)0x400104c)
-#define reg_G2S_DB_BLDCNT          (*(u16 *)0x4001050)
-#define reg_G2S_DB_BLDALPHA        (*(u16 *)0x4001052)
-#define reg_G2S_DB_BLDY            (*(u16 *)0x4001054)
-
-#define reg_GXS_DB_MASTER_BRIGHT   (*(u16 *)0x400106c)
-
-#define reg_MI_MCD1                (*(u32 *)0x4100010)
-#define reg_CARD_DATA              (*(u32 *)0x4100010) //?
+#define reg_CP_SQRT_PARAM_L        (*(volatile u32 *)0x40002B8)
+#define reg_CP_SQRT_PARAM_H        (*(volatile u32 *)0x40002Bc)
+
+#define reg_GX_POWCNT              (*(volatile u16 *)0x4000304)
+
+#define reg_G3X_RDLINES_COUNT      (*(const volatile u16 *)0x4000320)
+#define reg_G3X_EDGE_COLOR_0       (*(volatile u32 *)0x4000330)
+#define reg_G3X_EDGE_COLOR_0_L     (*(volatile u16 *)0x4000330)
+#define reg_G3X_EDGE_COLOR_0_H     (*(volatile u16 *)0x4000332)
+#define reg_G3X_EDGE_COLOR_1       (*(volatile u32 *)0x4000334)
+#define reg_G3X_EDGE_COLOR_1_L     (*(volatile u16 *)0x4000334)
+#define reg_G3X_EDGE_COLOR_1_H     (*(volatile u16 *)0x4000336)
+#define reg_G3X_EDGE_COLOR_2       (*(volatile u32 *)0x4000338)
+#define reg_G3X_EDGE_COLOR_2_L     (*(volatile u16 *)0x4000338)
+#define reg_G3X_EDGE_COLOR_2_H     (*(volatile u16 *)0x400033a)
+#define reg_G3X_EDGE_COLOR_3       (*(volatile u32 *)0x400033c)
+#define reg_G3X_EDGE_COLOR_3_L     (*(volatile u16 *)0x400033c)
+#define reg_G3X_EDGE_COLOR_3_H     (*(volatile u16 *)0x400033e)
+#define reg_G3X_ALPHA_TEST_REF     (*(volatile u16 *)0x4000340)
+#define reg_G3X_CLEAR_COLOR        (*(volatile u32 *)0x4000350)
+#define reg_G3X_CLEAR_DEPTH        (*(volatile u16 *)0x4000354)
+#define reg_G3X_CLRIMAGE_OFFSET    (*(volatile u16 *)0x4000356)
+#define reg_G3X_FOG_COLOR          (*(volatile u32 *)0x4000358)
+#define reg_G3X_FOG_OFFSET         (*(volatile u16 *)0x400035c)
+#define reg_G3X_FOG_TABLE_0        (*(volatile u32 *)0x4000360)
+#define reg_G3X_FOG_TABLE_0_L      (*(volatile u16 *)0x4000360)
+#define reg_G3X_FOG_TABLE_0_H      (*(volatile u16 *)0x4000362)
+#define reg_G3X_FOG_TABLE_1        (*(volatile u32 *)0x4000364)
+#define reg_G3X_FOG_TABLE_1_L      (*(volatile u16 *)0x4000364)
+#define reg_G3X_FOG_TABLE_1_H      (*(volatile u16 *)0x4000366)
+#define reg_G3X_FOG_TABLE_2        (*(volatile u32 *)0x4000368)
+#define reg_G3X_FOG_TABLE_2_L      (*(volatile u16 *)0x4000368)
+#define reg_G3X_FOG_TABLE_2_H      (*(volatile u16 *)0x400036a)
+#define reg_G3X_FOG_TABLE_3        (*(volatile u32 *)0x400036c)
+#define reg_G3X_FOG_TABLE_3_L      (*(volatile u16 *)0x400036c)
+#define reg_G3X_FOG_TABLE_3_H      (*(volatile u16 *)0x400036e)
+#define reg_G3X_FOG_TABLE_4        (*(volatile u32 *)0x4000370)
+#define reg_G3X_FOG_TABLE_4_L      (*(volatile u16 *)0x4000370)
+#define reg_G3X_FOG_TABLE_4_H      (*(volatile u16 *)0x4000372)
+#define reg_G3X_FOG_TABLE_5        (*(volatile u32 *)0x4000374)
+#define reg_G3X_FOG_TABLE_5_L      (*(volatile u16 *)0x4000374)
+#define reg_G3X_FOG_TABLE_5_H      (*(volatile u16 *)0x4000376)
+#define reg_G3X_FOG_TABLE_6        (*(volatile u32 *)0x4000378)
+#define reg_G3X_FOG_TABLE_6_L      (*(volatile u16 *)0x4000378)
+#define reg_G3X_FOG_TABLE_6_H      (*(volatile u16 *)0x400037a)
+#define reg_G3X_FOG_TABLE_7        (*(volatile u32 *)0x400037c)
+#define reg_G3X_FOG_TABLE_7_L      (*(volatile u16 *)0x400037c)
+#define reg_G3X_FOG_TABLE_7_H      (*(volatile u16 *)0x400037e)
+#define reg_G3X_TOON_TABLE_0       (*(volatile u32 *)0x4000380)
+#define reg_G3X_TOON_TABLE_0_L     (*(volatile u16 *)0x4000380)
+#define reg_G3X_TOON_TABLE_0_H     (*(volatile u16 *)0x4000382)
+#define reg_G3X_TOON_TABLE_1       (*(volatile u32 *)0x4000384)
+#define reg_G3X_TOON_TABLE_1_L     (*(volatile u16 *)0x4000384)
+#define reg_G3X_TOON_TABLE_1_H     (*(volatile u16 *)0x4000386)
+#define reg_G3X_TOON_TABLE_2       (*(volatile u32 *)0x4000388)
+#define reg_G3X_TOON_TABLE_2_L     (*(volatile u16 *)0x4000388)
+#define reg_G3X_TOON_TABLE_2_H     (*(volatile u16 *)0x400038a)
+#define reg_G3X_TOON_TABLE_3       (*(volatile u32 *)0x400038c)
+#define reg_G3X_TOON_TABLE_3_L     (*(volatile u16 *)0x400038c)
+#define reg_G3X_TOON_TABLE_3_H     (*(volatile u16 *)0x400038e)
+#define reg_G3X_TOON_TABLE_4       (*(volatile u32 *)0x4000390)
+#define reg_G3X_TOON_TABLE_4_L     (*(volatile u16 *)0x4000390)
+#define reg_G3X_TOON_TABLE_4_H     (*(volatile u16 *)0x4000392)
+#define reg_G3X_TOON_TABLE_5       (*(volatile u32 *)0x4000394)
+#define reg_G3X_TOON_TABLE_5_L     (*(volatile u16 *)0x4000394)
+#define reg_G3X_TOON_TABLE_5_H     (*(volatile u16 *)0x4000396)
+#define reg_G3X_TOON_TABLE_7       (*(volatile u32 *)0x400039c)
+#define reg_G3X_TOON_TABLE_7_L     (*(volatile u16 *)0x400039c)
+#define reg_G3X_TOON_TABLE_7_H     (*(volatile u16 *)0x400039e)
+#define reg_G3X_TOON_TABLE_8       (*(volatile u32 *)0x40003a0)
+#define reg_G3X_TOON_TABLE_8_L     (*(volatile u16 *)0x40003a0)
+#define reg_G3X_TOON_TABLE_8_H     (*(volatile u16 *)0x40003a2)
+#define reg_G3X_TOON_TABLE_9       (*(volatile u32 *)0x40003a4)
+#define reg_G3X_TOON_TABLE_9_L     (*(volatile u16 *)0x40003a4)
+#define reg_G3X_TOON_TABLE_9_H     (*(volatile u16 *)0x40003a6)
+#define reg_G3X_TOON_TABLE_10      (*(volatile u32 *)0x40003a8)
+#define reg_G3X_TOON_TABLE_10_L    (*(volatile u16 *)0x40003a8)
+#define reg_G3X_TOON_TABLE_10_H    (*(volatile u16 *)0x40003aa)
+#define reg_G3X_TOON_TABLE_11      (*(volatile u32 *)0x40003ac)
+#define reg_G3X_TOON_TABLE_11_L    (*(volatile u16 *)0x40003ac)
+#define reg_G3X_TOON_TABLE_11_H    (*(volatile u16 *)0x40003ae)
+#define reg_G3X_TOON_TABLE_12      (*(volatile u32 *)0x40003b0)
+#define reg_G3X_TOON_TABLE_12_L    (*(volatile u16 *)0x40003b0)
+#define reg_G3X_TOON_TABLE_12_H    (*(volatile u16 *)0x40003b2)
+#define reg_G3X_TOON_TABLE_13      (*(volatile u32 *)0x40003b4)
+#define reg_G3X_TOON_TABLE_13_L    (*(volatile u16 *)0x40003b4)
+#define reg_G3X_TOON_TABLE_13_H    (*(volatile u16 *)0x40003b6)
+#define reg_G3X_TOON_TABLE_14      (*(volatile u32 *)0x40003b8)
+#define reg_G3X_TOON_TABLE_14_L    (*(volatile u16 *)0x40003b8)
+#define reg_G3X_TOON_TABLE_14_H    (*(volatile u16 *)0x40003ba)
+#define reg_G3X_TOON_TABLE_15      (*(volatile u32 *)0x40003bc)
+#define reg_G3X_TOON_TABLE_15_L    (*(volatile u16 *)0x40003bc)
+#define reg_G3X_TOON_TABLE_15_H    (*(volatile u16 *)0x40003be)
+#define reg_G3X_GXFIFO             (*(volatile u32 *)0x4000400)
+
+#define reg_G3_MTX_MODE            (*(volatile u32 *)0x4000440)
+#define reg_G3_MTX_PUSH            (*(volatile u32 *)0x4000444)
+#define reg_G3_MTX_POP             (*(volatile u32 *)0x4000448)
+#define reg_G3_MTX_STORE           (*(volatile u32 *)0x400044c)
+#define reg_G3_MTX_RESTORE         (*(volatile u32 *)0x4000450)
+#define reg_G3_MTX_IDENTITY        (*(volatile u32 *)0x4000454)
+#define reg_G3_MTX_LOAD_4x4        (*(volatile u32 *)0x4000458)
+#define reg_G3_MTX_LOAD_4x3        (*(volatile u32 *)0x400045c)
+#define reg_G3_MTX_MULT_4x4        (*(volatile u32 *)0x4000460)
+#define reg_G3_MTX_MULT_4x3        (*(volatile u32 *)0x4000464)
+#define reg_G3_MTX_MULT_3x3        (*(volatile u32 *)0x4000468)
+#define reg_G3_MTX_SCALE           (*(volatile u32 *)0x400046c)
+#define reg_G3_MTX_TRANS           (*(volatile u32 *)0x4000470)
+#define reg_G3_COLOR               (*(volatile u32 *)0x4000480)
+#define reg_G3_NORMAL              (*(volatile u32 *)0x4000484)
+#define reg_G3_TEXCOORD            (*(volatile u32 *)0x4000488)
+#define reg_G3_VTX_16              (*(volatile u32 *)0x400048c)
+#define reg_G3_VTX_10              (*(volatile u32 *)0x4000490)
+#define reg_G3_VTX_XY              (*(volatile u32 *)0x4000494)
+#define reg_G3_VTX_XZ              (*(volatile u32 *)0x4000498)
+#define reg_G3_VTX_YZ              (*(volatile u32 *)0x400049c)
+#define reg_G3_VTX_DIFF            (*(volatile u32 *)0x40004a0)
+#define reg_G3_POLYGON_ATTR        (*(volatile u32 *)0x40004a4)
+#define reg_G3_TEXIMAGE_PARAM      (*(volatile u32 *)0x40004a8)
+#define reg_G3_TEXPLTT_BASE        (*(volatile u32 *)0x40004ac)
+#define reg_G3_DIF_AMB             (*(volatile u32 *)0x40004c0)
+#define reg_G3_SPE_EMI             (*(volatile u32 *)0x40004c4)
+#define reg_G3_LIGHT_VECTOR        (*(volatile u32 *)0x40004c8)
+#define reg_G3_LIGHT_COLOR         (*(volatile u32 *)0x40004cc)
+#define reg_G3_SHININESS           (*(volatile u32 *)0x40004d0)
+#define reg_G3_BEGIN_VTXS          (*(volatile u32 *)0x4000500)
+#define reg_G3_END_VTXS            (*(volatile u32 *)0x4000504)
+#define reg_G3_SWAP_BUFFERS        (*(volatile u32 *)0x4000540)
+#define reg_G3_VIEWPORT            (*(volatile u32 *)0x4000580)
+#define reg_G3_BOX_TEST            (*(volatile u32 *)0x40005c0)
+#define reg_G3_POS_TEST            (*(volatile u32 *)0x40005c4)
+#define reg_G3_VEC_TEST            (*(volatile u32 *)0x40005c8)
+
+#define reg_G3X_GXSTAT             (*(volatile u32 *)0x4000600)
+#define reg_G3X_LISTRAM_COUNT      (*(volatile u16 *)0x4000604)
+#define reg_G3X_VTXRAM_COUNT       (*(volatile u16 *)0x4000606)
+#define reg_G3X_DISP_1DOT_DEPTH    (*(volatile u16 *)0x4000610)
+#define reg_G3X_POS_RESULT_X       (*(const volatile u32 *)0x4000620)
+#define reg_G3X_POS_RESULT_Y       (*(const volatile u32 *)0x4000624)
+#define reg_G3X_POS_RESULT_Z       (*(const volatile u32 *)0x4000628)
+#define reg_G3X_POS_RESULT_W       (*(const volatile u32 *)0x400062c)
+#define reg_G3X_VEC_RESULT_X       (*(const volatile u16 *)0x4000630)
+#define reg_G3X_VEC_RESULT_Y       (*(const volatile u16 *)0x4000632)
+#define reg_G3X_VEC_RESULT_Z       (*(const volatile u16 *)0x4000634)
+#define reg_G3X_CLIPMTX_RESULT_0   (*(const volatile u32 *)0x4000640)
+#define reg_G3X_CLIPMTX_RESULT_1   (*(const volatile u32 *)0x4000644)
+#define reg_G3X_CLIPMTX_RESULT_2   (*(const volatile u32 *)0x4000648)
+#define reg_G3X_CLIPMTX_RESULT_3   (*(const volatile u32 *)0x400064c)
+#define reg_G3X_CLIPMTX_RESULT_4   (*(const volatile u32 *)0x4000650)
+#define reg_G3X_CLIPMTX_RESULT_5   (*(const volatile u32 *)0x4000654)
+#define reg_G3X_CLIPMTX_RESULT_6   (*(const volatile u32 *)0x4000658)
+#define reg_G3X_CLIPMTX_RESULT_7   (*(const volatile u32 *)0x400065c)
+#define reg_G3X_CLIPMTX_RESULT_8   (*(const volatile u32 *)0x4000660)
+#define reg_G3X_CLIPMTX_RESULT_9   (*(const volatile u32 *)0x4000664)
+#define reg_G3X_CLIPMTX_RESULT_10  (*(const volatile u32 *)0x4000668)
+#define reg_G3X_CLIPMTX_RESULT_11  (*(const volatile u32 *)0x400066c)
+#define reg_G3X_CLIPMTX_RESULT_12  (*(const volatile u32 *)0x4000670)
+#define reg_G3X_CLIPMTX_RESULT_13  (*(const volatile u32 *)0x4000674)
+#define reg_G3X_CLIPMTX_RESULT_14  (*(const volatile u32 *)0x4000678)
+#define reg_G3X_CLIPMTX_RESULT_15  (*(const volatile u32 *)0x400067c)
+#define reg_G3X_VECMTX_RESULT_0    (*(const volatile u32 *)0x4000680)
+#define reg_G3X_VECMTX_RESULT_1    (*(const volatile u32 *)0x4000684)
+#define reg_G3X_VECMTX_RESULT_2    (*(const volatile u32 *)0x4000688)
+#define reg_G3X_VECMTX_RESULT_3    (*(const volatile u32 *)0x400068c)
+#define reg_G3X_VECMTX_RESULT_4    (*(const volatile u32 *)0x4000690)
+#define reg_G3X_VECMTX_RESULT_5    (*(const volatile u32 *)0x4000694)
+#define reg_G3X_VECMTX_RESULT_6    (*(const volatile u32 *)0x4000698)
+#define reg_G3X_VECMTX_RESULT_7    (*(const volatile u32 *)0x400069c)
+#define reg_G3X_VECMTX_RESULT_8    (*(const volatile u32 *)0x40006a0)
+
+#define reg_GXS_DB_DISPCNT         (*(volatile u32 *)0x4001000)
+
+#define reg_G2S_DB_BG0CNT          (*(volatile u16 *)0x4001008)
+#define reg_G2S_DB_BG1CNT          (*(volatile u16 *)0x400100a)
+#define reg_G2S_DB_BG2CNT          (*(volatile u16 *)0x400100c)
+#define reg_G2S_DB_BG3CNT          (*(volatile u16 *)0x400100e)
+#define reg_G2S_DB_BG0OFS          (*(volatile u32 *)0x4001010)
+#define reg_G2S_DB_BG0HOFS         (*(volatile u16 *)0x4001010)
+#define reg_G2S_DB_BG0VOFS         (*(volatile u16 *)0x4001012)
+#define reg_G2S_DB_BG1OFS          (*(volatile u32 *)0x4001014)
+#define reg_G2S_DB_BG1HOFS         (*(volatile u16 *)0x4001014)
+#define reg_G2S_DB_BG1VOFS         (*(volatile u16 *)0x4001016)
+#define reg_G2S_DB_BG2OFS          (*(volatile u32 *)0x4001018)
+#define reg_G2S_DB_BG2HOFS         (*(volatile u16 *)0x4001018)
+#define reg_G2S_DB_BG2VOFS         (*(volatile u16 *)0x400101a)
+#define reg_G2S_DB_BG3OFS          (*(volatile u32 *)0x400101c)
+#define reg_G2S_DB_BG3HOFS         (*(volatile u16 *)0x400101c)
+#define reg_G2S_DB_BG3VOFS         (*(volatile u16 *)0x400101e)
+#define reg_G2S_DB_BG2PA           (*(volatile u16 *)0x4001020)
+#define reg_G2S_DB_BG2PB           (*(volatile u16 *)0x4001022)
+#define reg_G2S_DB_BG2PC           (*(volatile u16 *)0x4001024)
+#define reg_G2S_DB_BG2PD           (*(volatile u16 *)0x4001026)
+#define reg_G2S_DB_BG2X            (*(volatile u32 *)0x4001028)
+#define reg_G2S_DB_BG2Y            (*(volatile u32 *)0x400102c)
+#define reg_G2S_DB_BG3PA           (*(volatile u16 *)0x4001030)
+#define reg_G2S_DB_BG3PB           (*(volatile u16 *)0x4001032)
+#define reg_G2S_DB_BG3PC           (*(volatile u16 *)0x4001034)
+#define reg_G2S_DB_BG3PD           (*(volatile u16 *)0x4001036)
+#define reg_G2S_DB_BG3X            (*(volatile u32 *)0x4001038)
+#define reg_G2S_DB_BG3Y            (*(volatile u32 *)0x400103c)
+#define reg_G2S_DB_WIN0H           (*(volatile u16 *)0x4001040)
+#define reg_G2S_DB_WIN1H           (*(volatile u16 *)0x4001042)
+#define reg_G2S_DB_WIN0V           (*(volatile u16 *)0x4001044)
+#define reg_G2S_DB_WIN1V           (*(volatile u16 *)0x4001046)
+#define reg_G2S_DB_WININ           (*(volatile u16 *)0x4001048)
+#define reg_G2S_DB_WINOUT          (*(volatile u16 *)0x400104a)
+#define reg_G2S_DB_MOSAIC          (*(volatile u16 *)0x400104c)
+#define reg_G2S_DB_BLDCNT          (*(volatile u16 *)0x4001050)
+#define reg_G2S_DB_BLDALPHA        (*(volatile u16 *)0x4001052)
+#define reg_G2S_DB_BLDY            (*(volatile u16 *)0x4001054)
+
+#define reg_GXS_DB_MASTER_BRIGHT   (*(volatile u16 *)0x400106c)
+
+#define reg_MI_MCD1                (*(volatile u32 *)0x4100010)
+#define reg_CARD_DATA              (*(volatile u32 *)0x4100010) //?
 
 #define REG_OS_IE_VB_SHIFT                                 0
 #define REG_OS_IE_HB_SHIFT                                 1
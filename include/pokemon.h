@@ -659,6 +659,36 @@ enum
 #define EGG_MOVES_PER_MON 16 // need to go through later and make this editable
 #define NUM_EGG_MOVES_TOTAL 8000
 
+/**
+ *  @brief one entry of the egg move index, member 1 of ARC_EGG_MOVES
+ *
+ *  the first entry is a header whose offset is the number of species entries that follow.  every other entry points
+ *  at a species' egg moves in member 0, in halfwords.  built by scripts/eggmove_index.py
+ */
+struct __attribute__((packed)) EggMoveIndexEntry
+{
+    u16 offset;
+    u16 count;
+};
+
+/**
+ *  @brief header of CODE_ADDON_EVOLUTION_INDEX, built by scripts/evo_index.py from the evolution narc
+ *
+ *  followed by a u32 bitset of the species that evolve, a u16 per bitset word with the number of evolving species
+ *  before it, a u16 per evolving species (plus a last one) with the index of its first evolution, and then the
+ *  struct Evolution entries of every evolving species back to back, without the EVO_NONE padding
+ */
+struct __attribute__((packed)) EvolutionIndexHeader
+{
+    u16 species_count;
+    u16 evolving_count;
+    u16 evolution_count;
+    u16 padding;
+};
+
+// the whole evolution index is kept resident in bss.  scripts/evo_index.py fails the build if it grows past this
+#define EVOLUTION_INDEX_MAX_SIZE (0x1800)
+
 
 /**Trainer Data File Bitfield**/
 #define TRAINER_DATA_TYPE_NOTHING 0x00
@@ -1536,6 +1566,19 @@ u32 LONG_CALL CheckIfMonsAreEqual(struct PartyPokemon *pokemon1, struct PartyPok
  */
 u16 LONG_CALL GetMonEvolution(struct Party *party, struct PartyPokemon *pokemon, u8 context, u16 usedItem, int *method_ret);
 
+/**
+ *  @brief check every member of a party for an evolution in one call.  eggs and species that can't evolve are
+ *         skipped without touching the rest of their data
+ *
+ *  @param party Party to check
+ *  @param context EVOCTX_* constant deciding which evolution methods to check
+ *  @param usedItem item used on the party, if applicable
+ *  @param targets array of 6, filled with each member's target species or SPECIES_NONE
+ *  @param methods array of 6 to store each member's evolution method in, or NULL
+ *  @return bitmask of the party slots that have an evolution
+ */
+u32 LONG_CALL GetPartyEvolutions(struct Party *party, u8 context, u16 usedItem, u16 *targets, int *methods);
+
 /**
  *  @brief grab the sex given species, pid, and form
  *
@@ -1613,6 +1656,24 @@ bool8 LONG_CALL RevertFormChange(struct PartyPokemon *pp, u16 species, u8 form_n
  */
 void LONG_CALL ClearMonMoves(struct PartyPokemon *pokemon);
 
+// defined in src/evolution_index.c
+/**
+ *  @brief check if a species has any evolutions.  loads CODE_ADDON_EVOLUTION_INDEX into bss the first time it runs
+ *
+ *  @param species species index with the form already factored in
+ *  @return TRUE if the species has at least one evolution
+ */
+BOOL LONG_CALL SpeciesHasEvolutions(u32 species);
+
+/**
+ *  @brief find a species' evolutions in the evolution index
+ *
+ *  @param species species index with the form already factored in
+ *  @param count filled with the number of evolutions, 0 if the species doesn't evolve
+ *  @return the species' evolutions in the order the evolution file lists them, without EVO_NONE entries
+ */
+struct Evolution *LONG_CALL GetSpeciesEvolutions(u32 species, int *count);
+
 // defined in src/moves.c--can't just define in battles, sadly.  does need BattleMove structure from battle.h, though
 /**
  *  @brief get move data field requested from ARC_MOVE_DATA
@@ -1623,5 +1684,10 @@ void LONG_CALL ClearMonMoves(struct PartyPokemon *pokemon);
  */
 u32 LONG_CALL GetMoveData(u16 id, u32 field);
 
+/**
+ *  @brief drop the resident move data cache so GetMoveData reloads it from ARC_MOVE_DATA on its next call
+ */
+void InvalidateMoveDataCache(void);
+
 
 #endif
@@ -0,0 +1,142 @@
+// no include guard: this is an X-macro list that gets included once per expansion.
+// the includer defines TYPE_EFF(move type, defending type, effectiveness) and
+// TYPE_EFF_FORESIGHT(...) for the rows that foresight and scrappy ignore.
+// 0 is ineffective, 5 is not very effective, 20 is super effective.
+// a move type/defending type pair may only be listed once across both macros.
+
+TYPE_EFF(TYPE_NORMAL, TYPE_ROCK, 0x05)
+TYPE_EFF(TYPE_NORMAL, TYPE_STEEL, 0x05)
+TYPE_EFF(TYPE_FIGHTING, TYPE_NORMAL, 0x14)
+TYPE_EFF(TYPE_FIGHTING, TYPE_FLYING, 0x05)
+TYPE_EFF(TYPE_FIGHTING, TYPE_POISON, 0x05)
+TYPE_EFF(TYPE_FIGHTING, TYPE_ROCK, 0x14)
+TYPE_EFF(TYPE_FIGHTING, TYPE_BUG, 0x05)
+TYPE_EFF(TYPE_FIGHTING, TYPE_STEEL, 0x14)
+#if FAIRY_TYPE_IMPLEMENTED == 1
+TYPE_EFF(TYPE_FIGHTING, TYPE_FAIRY, 0x05)
+#endif
+TYPE_EFF(TYPE_FIGHTING, TYPE_PSYCHIC, 0x05)
+TYPE_EFF(TYPE_FIGHTING, TYPE_ICE, 0x14)
+TYPE_EFF(TYPE_FIGHTING, TYPE_DARK, 0x14)
+TYPE_EFF(TYPE_FLYING, TYPE_FIGHTING, 0x14)
+TYPE_EFF(TYPE_FLYING, TYPE_ROCK, 0x05)
+TYPE_EFF(TYPE_FLYING, TYPE_BUG, 0x14)
+TYPE_EFF(TYPE_FLYING, TYPE_STEEL, 0x05)
+TYPE_EFF(TYPE_FLYING, TYPE_GRASS, 0x14)
+TYPE_EFF(TYPE_FLYING, TYPE_ELECTRIC, 0x05)
+TYPE_EFF(TYPE_POISON, TYPE_POISON, 0x05)
+TYPE_EFF(TYPE_POISON, TYPE_GROUND, 0x05)
+TYPE_EFF(TYPE_POISON, TYPE_ROCK, 0x05)
+TYPE_EFF(TYPE_POISON, TYPE_GHOST, 0x05)
+TYPE_EFF(TYPE_POISON, TYPE_STEEL, 0x00)
+#if FAIRY_TYPE_IMPLEMENTED == 1
+TYPE_EFF(TYPE_POISON, TYPE_FAIRY, 0x14)
+#endif
+TYPE_EFF(TYPE_POISON, TYPE_GRASS, 0x14)
+TYPE_EFF(TYPE_GROUND, TYPE_FLYING, 0x00)
+TYPE_EFF(TYPE_GROUND, TYPE_POISON, 0x14)
+TYPE_EFF(TYPE_GROUND, TYPE_ROCK, 0x14)
+TYPE_EFF(TYPE_GROUND, TYPE_BUG, 0x05)
+TYPE_EFF(TYPE_GROUND, TYPE_STEEL, 0x14)
+TYPE_EFF(TYPE_GROUND, TYPE_FIRE, 0x14)
+TYPE_EFF(TYPE_GROUND, TYPE_GRASS, 0x05)
+TYPE_EFF(TYPE_GROUND, TYPE_ELECTRIC, 0x14)
+TYPE_EFF(TYPE_ROCK, TYPE_FIGHTING, 0x05)
+TYPE_EFF(TYPE_ROCK, TYPE_FLYING, 0x14)
+TYPE_EFF(TYPE_ROCK, TYPE_GROUND, 0x05)
+TYPE_EFF(TYPE_ROCK, TYPE_BUG, 0x14)
+TYPE_EFF(TYPE_ROCK, TYPE_STEEL, 0x05)
+TYPE_EFF(TYPE_ROCK, TYPE_FIRE, 0x14)
+TYPE_EFF(TYPE_ROCK, TYPE_ICE, 0x14)
+TYPE_EFF(TYPE_BUG, TYPE_FIGHTING, 0x05)
+TYPE_EFF(TYPE_BUG, TYPE_FLYING, 0x05)
+TYPE_EFF(TYPE_BUG, TYPE_POISON, 0x05)
+TYPE_EFF(TYPE_BUG, TYPE_GHOST, 0x05)
+TYPE_EFF(TYPE_BUG, TYPE_STEEL, 0x05)
+#if FAIRY_TYPE_IMPLEMENTED == 1
+TYPE_EFF(TYPE_BUG, TYPE_FAIRY, 0x05)
+#endif
+TYPE_EFF(TYPE_BUG, TYPE_FIRE, 0x05)
+TYPE_EFF(TYPE_BUG, TYPE_GRASS, 0x14)
+TYPE_EFF(TYPE_BUG, TYPE_PSYCHIC, 0x14)
+TYPE_EFF(TYPE_BUG, TYPE_DARK, 0x14)
+TYPE_EFF(TYPE_GHOST, TYPE_NORMAL, 0x00)
+TYPE_EFF(TYPE_GHOST, TYPE_GHOST, 0x14)
+TYPE_EFF(TYPE_GHOST, TYPE_PSYCHIC, 0x14)
+TYPE_EFF(TYPE_GHOST, TYPE_DARK, 0x05)
+TYPE_EFF(TYPE_STEEL, TYPE_ROCK, 0x14)
+TYPE_EFF(TYPE_STEEL, TYPE_STEEL, 0x05)
+#if FAIRY_TYPE_IMPLEMENTED == 1
+TYPE_EFF(TYPE_STEEL, TYPE_FAIRY, 0x14)
+#endif
+TYPE_EFF(TYPE_STEEL, TYPE_FIRE, 0x05)
+TYPE_EFF(TYPE_STEEL, TYPE_WATER, 0x05)
+TYPE_EFF(TYPE_STEEL, TYPE_ELECTRIC, 0x05)
+TYPE_EFF(TYPE_STEEL, TYPE_ICE, 0x14)
+TYPE_EFF(TYPE_STEEL, TYPE_DARK, 0x0A)
+#if FAIRY_TYPE_IMPLEMENTED == 1
+TYPE_EFF(TYPE_FAIRY, TYPE_FIGHTING, 0x14)
+TYPE_EFF(TYPE_FAIRY, TYPE_POISON, 0x05)
+TYPE_EFF(TYPE_FAIRY, TYPE_STEEL, 0x05)
+TYPE_EFF(TYPE_FAIRY, TYPE_FIRE, 0x05)
+TYPE_EFF(TYPE_FAIRY, TYPE_DRAGON, 0x14)
+TYPE_EFF(TYPE_FAIRY, TYPE_DARK, 0x14)
+#endif
+TYPE_EFF(TYPE_FIRE, TYPE_ROCK, 0x05)
+TYPE_EFF(TYPE_FIRE, TYPE_BUG, 0x14)
+TYPE_EFF(TYPE_FIRE, TYPE_STEEL, 0x14)
+TYPE_EFF(TYPE_FIRE, TYPE_FIRE, 0x05)
+TYPE_EFF(TYPE_FIRE, TYPE_WATER, 0x05)
+TYPE_EFF(TYPE_FIRE, TYPE_GRASS, 0x14)
+TYPE_EFF(TYPE_FIRE, TYPE_ICE, 0x14)
+TYPE_EFF(TYPE_FIRE, TYPE_DRAGON, 0x05)
+TYPE_EFF(TYPE_WATER, TYPE_GROUND, 0x14)
+TYPE_EFF(TYPE_WATER, TYPE_ROCK, 0x14)
+TYPE_EFF(TYPE_WATER, TYPE_FIRE, 0x14)
+TYPE_EFF(TYPE_WATER, TYPE_WATER, 0x05)
+TYPE_EFF(TYPE_WATER, TYPE_GRASS, 0x05)
+TYPE_EFF(TYPE_WATER, TYPE_DRAGON, 0x05)
+TYPE_EFF(TYPE_GRASS, TYPE_FLYING, 0x05)
+TYPE_EFF(TYPE_GRASS, TYPE_POISON, 0x05)
+TYPE_EFF(TYPE_GRASS, TYPE_GROUND, 0x14)
+TYPE_EFF(TYPE_GRASS, TYPE_ROCK, 0x14)
+TYPE_EFF(TYPE_GRASS, TYPE_BUG, 0x05)
+TYPE_EFF(TYPE_GRASS, TYPE_STEEL, 0x05)
+TYPE_EFF(TYPE_GRASS, TYPE_FIRE, 0x05)
+TYPE_EFF(TYPE_GRASS, TYPE_WATER, 0x14)
+TYPE_EFF(TYPE_GRASS, TYPE_GRASS, 0x05)
+TYPE_EFF(TYPE_GRASS, TYPE_DRAGON, 0x05)
+TYPE_EFF(TYPE_ELECTRIC, TYPE_FLYING, 0x14)
+TYPE_EFF(TYPE_ELECTRIC, TYPE_GROUND, 0x00)
+TYPE_EFF(TYPE_ELECTRIC, TYPE_WATER, 0x14)
+TYPE_EFF(TYPE_ELECTRIC, TYPE_GRASS, 0x05)
+TYPE_EFF(TYPE_ELECTRIC, TYPE_ELECTRIC, 0x05)
+TYPE_EFF(TYPE_ELECTRIC, TYPE_DRAGON, 0x05)
+TYPE_EFF(TYPE_PSYCHIC, TYPE_FIGHTING, 0x14)
+TYPE_EFF(TYPE_PSYCHIC, TYPE_POISON, 0x14)
+TYPE_EFF(TYPE_PSYCHIC, TYPE_STEEL, 0x05)
+TYPE_EFF(TYPE_PSYCHIC, TYPE_PSYCHIC, 0x05)
+TYPE_EFF(TYPE_PSYCHIC, TYPE_DARK, 0x00)
+TYPE_EFF(TYPE_ICE, TYPE_FLYING, 0x14)
+TYPE_EFF(TYPE_ICE, TYPE_GROUND, 0x14)
+TYPE_EFF(TYPE_ICE, TYPE_STEEL, 0x05)
+TYPE_EFF(TYPE_ICE, TYPE_FIRE, 0x05)
+TYPE_EFF(TYPE_ICE, TYPE_WATER, 0x05)
+TYPE_EFF(TYPE_ICE, TYPE_GRASS, 0x14)
+TYPE_EFF(TYPE_ICE, TYPE_ICE, 0x05)
+TYPE_EFF(TYPE_ICE, TYPE_DRAGON, 0x14)
+TYPE_EFF(TYPE_DRAGON, TYPE_STEEL, 0x05)
+#if FAIRY_TYPE_IMPLEMENTED == 1
+TYPE_EFF(TYPE_DRAGON, TYPE_FAIRY, 0x00)
+#endif
+TYPE_EFF(TYPE_DRAGON, TYPE_DRAGON, 0x14)
+TYPE_EFF(TYPE_DARK, TYPE_FIGHTING, 0x05)
+TYPE_EFF(TYPE_DARK, TYPE_GHOST, 0x14)
+#if FAIRY_TYPE_IMPLEMENTED == 1
+TYPE_EFF(TYPE_DARK, TYPE_FAIRY, 0x05)
+#endif
+TYPE_EFF(TYPE_DARK, TYPE_PSYCHIC, 0x14)
+TYPE_EFF(TYPE_DARK, TYPE_DARK, 0x05)
+
+TYPE_EFF_FORESIGHT(TYPE_NORMAL, TYPE_GHOST, 0x00)
+TYPE_EFF_FORESIGHT(TYPE_FIGHTING, TYPE_GHOST, 0x00)
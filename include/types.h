@@ -18,8 +18,7 @@ typedef int64_t  s64;
 #define FALSE 0
 
 #define NELEMS(array) (sizeof(array) / sizeof(array[0]))
-#define offsetof(st, m) \
-    ((u32)&(((st *)0)->m))
+#define offsetof(st, m) __builtin_offsetof(st, m)
 
 typedef u8  bool8;
 typedef int  BOOL;
@@ -61,8 +60,14 @@ VecFx32;
 
 #define	ALIGN4 __attribute__((aligned(4)))
 #define MOVE_TABLES_TERMIN 0xFEFE
+#ifdef HOST_BUILD
+// tools/source/battlesim builds parts of src/ natively, where there is no thumb mode and everything is in reach
+#define THUMB_FUNC
+#define LONG_CALL
+#else
 #define THUMB_FUNC __attribute__((target("thumb")))
 #define LONG_CALL __attribute__((long_call))
+#endif // HOST_BUILD
 #define UNUSED __attribute__((unused))
 #define FALLTHROUGH __attribute__ ((fallthrough))
 
@@ -75,7 +80,7 @@ VecFx32;
 #define No2Bit(n) ((1) << (n))
 
 // validates a pointer's value
-#define IS_NOT_VALID_EWRAM_POINTER(n) ((u32)(n) >= 0x03000000 || (u32)(n) < 0x02000000)
+#define IS_NOT_VALID_EWRAM_POINTER(n) ((unsigned long)(n) >= 0x03000000 || (unsigned long)(n) < 0x02000000)
 
 void LONG_CALL GF_ASSERT(u32 cond);
 u16 LONG_CALL gf_rand(void);
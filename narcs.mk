@@ -26,8 +26,8 @@ BATTLEHUD_TARGET := $(FILESYS)/a/0/0/7
 BATTLEHUD_DEPENDENCIES_DIR := rawdata/battle_sprite
 BATTLEHUD_DEPENDENCIES := $(wildcard $(BATTLEHUD_DEPENDENCIES_DIR)/*)
 
-$(BATTLEHUD_NARC): $(BATTLEHUD_DEPENDENCIES)
-	$(NARCHIVE) extract $(BATTLEHUD_TARGET) -o $(BATTLEHUD_DIR) -nf
+$(BATTLEHUD_NARC): $(BATTLEHUD_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(BATTLEHUD_TARGET)) -o $(BATTLEHUD_DIR) -nf
 	cp -r $(BATTLEHUD_DEPENDENCIES_DIR)/. $(BATTLEHUD_DIR)
 	$(NARCHIVE) create $@ $(BATTLEHUD_DIR) -nf
 
@@ -54,8 +54,8 @@ MOVEPARTICLES_TARGET := $(FILESYS)/a/0/2/9
 MOVEPARTICLES_DEPENDENCIES_DIR := rawdata/move_spa
 MOVEPARTICLES_DEPENDENCIES := $(wildcard $(MOVEPARTICLES_DEPENDENCIES_DIR)/*)
 
-$(MOVEPARTICLES_NARC): $(MOVEPARTICLES_DEPENDENCIES)
-	$(NARCHIVE) extract $(MOVEPARTICLES_TARGET) -o $(MOVEPARTICLES_DIR) -nf
+$(MOVEPARTICLES_NARC): $(MOVEPARTICLES_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(MOVEPARTICLES_TARGET)) -o $(MOVEPARTICLES_DIR) -nf
 	cp -r $(MOVEPARTICLES_DEPENDENCIES_DIR)/. $(MOVEPARTICLES_DIR)
 	$(NARCHIVE) create $@ $(MOVEPARTICLES_DIR) -nf
 
@@ -68,8 +68,8 @@ OPENDEMO_TARGET := $(FILESYS)/a/2/6/2
 OPENDEMO_DEPENDENCIES_DIR := rawdata/op_demo
 OPENDEMO_DEPENDENCIES := $(wildcard $(OPENDEMO_DEPENDENCIES_DIR)/*)
 
-$(OPENDEMO_NARC): $(OPENDEMO_DEPENDENCIES)
-	$(NARCHIVE) extract $(OPENDEMO_TARGET) -o $(OPENDEMO_DIR) -nf
+$(OPENDEMO_NARC): $(OPENDEMO_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(OPENDEMO_TARGET)) -o $(OPENDEMO_DIR) -nf
 	cp -r $(OPENDEMO_DEPENDENCIES_DIR)/. $(OPENDEMO_DIR)
 	$(NARCHIVE) create $@ $(OPENDEMO_DIR) -nf
 
@@ -101,8 +101,8 @@ SPRITEOFFSETS_NARC := $(BUILD_NARC)/spriteoffsets.narc
 SPRITEOFFSETS_TARGET := $(FILESYS)/a/1/8/0
 SPRITEOFFSETS_DEPENDENCIES := armips/data/spriteoffsets.s
 
-$(SPRITEOFFSETS_NARC): $(SPRITEOFFSETS_DEPENDENCIES)
-	$(NARCHIVE) extract $(SPRITEOFFSETS_TARGET) -o $(SPRITEOFFSETS_DIR) -nf
+$(SPRITEOFFSETS_NARC): $(SPRITEOFFSETS_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(SPRITEOFFSETS_TARGET)) -o $(SPRITEOFFSETS_DIR) -nf
 	$(ARMIPS) $^
 	$(NARCHIVE) create $@ $(SPRITEOFFSETS_DIR) -nf
 
@@ -156,11 +156,12 @@ EGGMOVES_DIR := $(BUILD)/kowaza
 EGGMOVES_NARC := $(BUILD_NARC)/kowaza.narc
 EGGMOVES_TARGET := $(FILESYS)/a/2/2/9
 EGGMOVES_TARGET_2 := $(FILESYS)/data/kowaza.narc
-EGGMOVES_DEPENDENCIES := armips/data/eggmoves.s
+EGGMOVES_DEPENDENCIES := armips/data/eggmoves.s scripts/eggmove_index.py
 
 $(EGGMOVES_NARC): $(EGGMOVES_DEPENDENCIES)
 	mkdir -p $(EGGMOVES_DIR)
-	$(ARMIPS) $^
+	$(ARMIPS) armips/data/eggmoves.s
+	$(PYTHON) scripts/eggmove_index.py $(EGGMOVES_DIR)/kowaza_0 $(EGGMOVES_DIR)/kowaza_1
 	$(NARCHIVE) create $@ $(EGGMOVES_DIR) -nf
 
 NARC_FILES += $(EGGMOVES_NARC)
@@ -169,11 +170,13 @@ NARC_FILES += $(EGGMOVES_NARC)
 EVOS_DIR := $(BUILD)/a034
 EVOS_NARC := $(BUILD_NARC)/a034.narc
 EVOS_TARGET := $(FILESYS)/a/0/3/4
-EVOS_DEPENDENCIES := armips/data/evodata.s
+EVOS_DEPENDENCIES := armips/data/evodata.s scripts/evo_index.py include/pokemon.h
 
+# the evolution index is code addon 10, picked up by the a028 update at the end of the build
 $(EVOS_NARC): $(EVOS_DEPENDENCIES)
-	mkdir -p $(EVOS_DIR)
-	$(ARMIPS) $^
+	mkdir -p $(EVOS_DIR) $(BUILD)/a028
+	$(ARMIPS) armips/data/evodata.s
+	$(PYTHON) scripts/evo_index.py $(EVOS_DIR) $(BUILD)/a028/8_10
 	$(NARCHIVE) create $@ $(EVOS_DIR) -nf
 
 NARC_FILES += $(EVOS_NARC)
@@ -356,8 +359,8 @@ $(ITEMGFX_DIR)/9_%-01.NCLR:$(ITEMGFX_DEPENDENCIES_DIR)/%.png
 	$(GFX) $< $@ -ir -bitdepth 4
 
 # go overkill on the removal + support 4-digit removal, so that's fine
-$(ITEMGFX_NARC): $(ITEMGFX_OBJS) $(ITEMGFX_PALS)
-	$(NARCHIVE) extract $(ITEMGFX_TARGET) -o $(ITEMGFX_DIR) -nf
+$(ITEMGFX_NARC): $(ITEMGFX_OBJS) $(ITEMGFX_PALS) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(ITEMGFX_TARGET)) -o $(ITEMGFX_DIR) -nf
 	for n in $$(seq 797 $$(expr $$(ls $(ITEMGFX_DIR) | wc -l) - 1)); do rm -f $(ITEMGFX_DIR)/8_$$n; done
 	for n in $$(seq 797 $$(expr $$(ls $(ITEMGFX_DIR) | wc -l) - 1)); do rm -f $(ITEMGFX_DIR)/8_$$(printf "%04d" $$n); done
 	$(NARCHIVE) create $@ $(ITEMGFX_DIR) -nf
@@ -400,8 +403,8 @@ $(OVERWORLDS_DIR)/2_%_shiny:$(OVERWORLDS_DEPENDENCIES_DIR)/%_shiny.png
 $(OVERWORLDS_DIR)/2_%:$(OVERWORLDS_DEPENDENCIES_DIR)/%.png
 	$(BTX) $< $@
 
-overworld_extract:
-	$(NARCHIVE) extract $(OVERWORLDS_TARGET) -o $(OVERWORLDS_DIR) -nf
+overworld_extract: | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(OVERWORLDS_TARGET)) -o $(OVERWORLDS_DIR) -nf
 	@rm -rf $(patsubst $(OVERWORLDS_DIR)/3_0%,$(OVERWORLDS_DIR)/1_%,$(OVERWORLDS_OBJ_FILTERS))
 	@rm -rf $(patsubst $(OVERWORLDS_DIR)/3_%,$(OVERWORLDS_DIR)/1_%,$(OVERWORLDS_OBJ_FILTERS))
 	@rm -f $(OVERWORLDS_NARC)
@@ -418,8 +421,8 @@ DEXGFX_TARGET := $(FILESYS)/a/0/6/8
 DEXGFX_DEPENDENCIES_DIR := rawdata/dex_gfx
 DEXGFX_DEPENDENCIES := $(wildcard $(DEXGFX_DEPENDENCIES_DIR)/*)
 
-$(DEXGFX_NARC): $(DEXGFX_DEPENDENCIES)
-	$(NARCHIVE) extract $(DEXGFX_TARGET) -o $(DEXGFX_DIR) -nf
+$(DEXGFX_NARC): $(DEXGFX_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(DEXGFX_TARGET)) -o $(DEXGFX_DIR) -nf
 	cp -r $(DEXGFX_DEPENDENCIES_DIR)/. $(DEXGFX_DIR)
 	$(NARCHIVE) create $@ $(DEXGFX_DIR) -nf
 
@@ -433,8 +436,8 @@ BATTLEGFX_DEPENDENCIES_DIR := rawdata/battle_gfx
 BATTLEWEATHERGFX_DEPENDENCIES_DIR := rawdata/weather_icons
 BATTLEGFX_DEPENDENCIES := $(wildcard $(BATTLEGFX_DEPENDENCIES_DIR)/*) $(wildcard $(BATTLEWEATHERGFX_DEPENDENCIES_DIR)/*)
 
-$(BATTLEGFX_NARC): $(BATTLEGFX_DEPENDENCIES)
-	$(NARCHIVE) extract $(BATTLEGFX_TARGET) -o $(BATTLEGFX_DIR) -nf
+$(BATTLEGFX_NARC): $(BATTLEGFX_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(BATTLEGFX_TARGET)) -o $(BATTLEGFX_DIR) -nf
 	for n in $$(seq 346 $$(expr $$(ls $(BATTLEGFX_DIR) | wc -l) - 1)); do rm -f $(BATTLEGFX_DIR)/8_$$n; done
 	cp -r $(BATTLEGFX_DEPENDENCIES_DIR)/. $(BATTLEGFX_DIR)
 	for file in $(BATTLEWEATHERGFX_DEPENDENCIES_DIR)/*.png; do $(GFX) $$file $(BATTLEGFX_DIR)/$$(basename $$file .png)-00.NCGR; $(GFX) $$file $(BATTLEGFX_DIR)/$$(basename $$file .png)-01.NCLR -bitdepth 8 -nopad -comp 10; done
@@ -449,8 +452,8 @@ OTHERPOKE_TARGET := $(FILESYS)/a/1/1/4
 OTHERPOKE_DEPENDENCIES_DIR := rawdata/otherpoke
 OTHERPOKE_DEPENDENCIES := $(wildcard $(OTHERPOKE_DEPENDENCIES_DIR)/*)
 
-$(OTHERPOKE_NARC): $(OTHERPOKE_DEPENDENCIES)
-	$(NARCHIVE) extract $(OTHERPOKE_TARGET) -o $(OTHERPOKE_DIR) -nf
+$(OTHERPOKE_NARC): $(OTHERPOKE_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(OTHERPOKE_TARGET)) -o $(OTHERPOKE_DIR) -nf
 	@rm -f $(OTHERPOKE_DIR)/4_212 $(OTHERPOKE_DIR)/4_213
 	$(GFX) $(OTHERPOKE_DEPENDENCIES_DIR)/arceus-fairy-normal.pal $(OTHERPOKE_DIR)/4_212.NCLR -bitdepth 8 -nopad -comp 10
 	$(GFX) $(OTHERPOKE_DEPENDENCIES_DIR)/arceus-fairy-shiny.pal $(OTHERPOKE_DIR)/4_213.NCLR -bitdepth 8 -nopad -comp 10
@@ -506,8 +509,8 @@ $(SDAT_OBJ_DIR)/WAVARC/WAVE_ARC_PV%.swar:$(SDAT_OBJ_DIR)/WAVARC/WAVE_ARC_PV%/00.
 # we need to unpack the sdat
 # move the swav/swar/sbnk over
 # reorder cries 387+ to be numerical order in the FileBlock.json and InfoBlock.json
-$(SDAT_BUILD):$(SDAT_SWAR_OBJS)
-	$(SDATTOOL) -u $(SDAT_TARGET) $(SDAT_DIR)
+$(SDAT_BUILD):$(SDAT_SWAR_OBJS) | $(BASE_CACHE_STAMP)
+	$(SDATTOOL) -u $(call PRISTINE,$(SDAT_TARGET)) $(SDAT_DIR)
 	cp -r $(SDAT_OBJ_DIR)/* $(SDAT_FILES_DIR)
 	$(PYTHON) scripts/rebuild_json.py
 	$(SDATTOOL) -b $@ $(SDAT_DIR)
@@ -520,8 +523,8 @@ FONT_TARGET := $(FILESYS)/a/0/1/6
 FONT_DEPENDENCIES_DIR := rawdata/font
 FONT_DEPENDENCIES := $(wildcard $(FONT_DEPENDENCIES_DIR)/*)
 
-$(FONT_NARC): $(FONT_DEPENDENCIES)
-	$(NARCHIVE) extract $(FONT_TARGET) -o $(FONT_DIR) -nf
+$(FONT_NARC): $(FONT_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(FONT_TARGET)) -o $(FONT_DIR) -nf
 	cp -r $(FONT_DEPENDENCIES_DIR)/. $(FONT_DIR)
 	$(NARCHIVE) create $@ $(FONT_DIR) -nf
 
@@ -533,18 +536,17 @@ TEXTBOX_TARGET := $(FILESYS)/a/0/3/8
 TEXTBOX_DEPENDENCIES_DIR := rawdata/textbox
 TEXTBOX_DEPENDENCIES := $(wildcard $(TEXTBOX_DEPENDENCIES_DIR)/*)
 
-$(TEXTBOX_NARC): $(TEXTBOX_DEPENDENCIES)
-	$(NARCHIVE) extract $(TEXTBOX_TARGET) -o $(TEXTBOX_DIR) -nf
+$(TEXTBOX_NARC): $(TEXTBOX_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(TEXTBOX_TARGET)) -o $(TEXTBOX_DIR) -nf
 	cp -r $(TEXTBOX_DEPENDENCIES_DIR)/. $(TEXTBOX_DIR)
 	$(NARCHIVE) create $@ $(TEXTBOX_DIR) -nf
 
 NARC_FILES += $(TEXTBOX_NARC)
 
 
-$(MSGDATA_NARC): $(MSGDATA_DEPENDENCIES) $(MSGDATA_COMPILETIME_DEPENDENCIES)
-	$(NARCHIVE) extract $(MSGDATA_TARGET) -o $(MSGDATA_DIR) -nf
-	for file in $^; do $(MSGENC) -e -c $(CHARMAP) $$file $(MSGDATA_DIR)/7_$$(basename $$file .txt); done
-	$(NARCHIVE) create $@ $(MSGDATA_DIR) -nf
+$(MSGDATA_NARC): $(MSGDATA_DEPENDENCIES) $(MSGDATA_COMPILETIME_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(MSGDATA_TARGET)) -o $(MSGDATA_DIR) -nf
+	$(MSGENC) -e -c $(CHARMAP) -o $(MSGDATA_DIR) -p 7_ -n $@ $^
 
 
 BALL_SPA_DIR := $(BUILD)/ball_spa
@@ -553,8 +555,8 @@ BALL_SPA_TARGET := $(FILESYS)/a/0/9/5
 BALL_SPA_DEPENDENCIES_DIR := rawdata/ball_spa
 BALL_SPA_DEPENDENCIES := $(wildcard $(BALL_SPA_DEPENDENCIES_DIR)/*)
 
-$(BALL_SPA_NARC): $(BALL_SPA_DEPENDENCIES)
-	$(NARCHIVE) extract $(BALL_SPA_TARGET) -o $(BALL_SPA_DIR) -nf
+$(BALL_SPA_NARC): $(BALL_SPA_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(BALL_SPA_TARGET)) -o $(BALL_SPA_DIR) -nf
 	cp -r $(BALL_SPA_DEPENDENCIES_DIR)/. $(BALL_SPA_DIR)
 	$(NARCHIVE) create $@ $(BALL_SPA_DIR) -nf
 
@@ -607,8 +609,8 @@ SCR_SEQ_TARGET := $(FILESYS)/a/0/1/2
 SCR_SEQ_DEPENDENCIES_DIR := armips/scr_seq
 SCR_SEQ_DEPENDENCIES := $(SCR_SEQ_DEPENDENCIES_DIR)/*
 
-$(SCR_SEQ_NARC): $(SCR_SEQ_DEPENDENCIES)
-	$(NARCHIVE) extract $(SCR_SEQ_TARGET) -o $(SCR_SEQ_DIR) -nf
+$(SCR_SEQ_NARC): $(SCR_SEQ_DEPENDENCIES) | $(BASE_CACHE_STAMP)
+	$(NARCHIVE) extract $(call PRISTINE,$(SCR_SEQ_TARGET)) -o $(SCR_SEQ_DIR) -nf
 	for file in $^; do $(ARMIPS) $$file; done
 	$(NARCHIVE) create $@ $(SCR_SEQ_DIR) -nf
 
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+
+# reads the battle script profile that DEBUG_BATTLE_SCRIPT_PROFILER (include/debug.h) records out of a main ram dump
+# taken during a battle, and prints either the most expensive commands and scripts or folded stacks for a flame graph
+# (flamegraph.pl, speedscope, inferno...).  the layout read here is struct BattleScriptProfile in include/battle.h.
+
+import argparse
+import re
+import struct
+import sys
+
+PROFILE_MAGIC = 0x46505342
+HEADER = struct.Struct('<IHHIQ')
+TRACE_ENTRY = struct.Struct('<IBBHHH')
+BUS_CLOCK = 33513982
+
+BATTLE_SCRIPT_COMMANDS = 'src/battle/battle_script_commands.c'
+SCRIPT_KINDS = {
+    0: ('move', 'include/constants/moves.h', 'MOVE_'),
+    1: ('sub', 'include/constants/battle_script_constants.h', 'SUB_SEQ_'),
+    30: ('effect', 'include/constants/move_effects.h', 'MOVE_EFFECT_'),
+}
+
+
+def read_command_names(path):
+    names = []
+    try:
+        with open(path, encoding='utf-8') as file:
+            text = file.read()
+    except OSError:
+        return names
+    match = re.search(r'BattleScrCmdNames\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    if match:
+        names = re.findall(r'"([^"]*)"', match.group(1))
+    return names
+
+
+def read_defines(path, prefix):
+    defines = {}
+    try:
+        with open(path, encoding='utf-8') as file:
+            for line in file:
+                match = re.match(r'\s*#define\s+(' + prefix + r'\w+)\s+\(?\s*(0x[0-9A-Fa-f]+|\d+)\s*\)?', line)
+                if match:
+                    defines.setdefault(int(match.group(2), 0), match.group(1))
+    except OSError:
+        pass
+    return defines
+
+
+def find_profile(dump, offset):
+    if offset is not None:
+        return offset
+    candidates = []
+    start = 0
+    magic = struct.pack('<I', PROFILE_MAGIC)
+    while True:
+        start = dump.find(magic, start)
+        if start < 0:
+            break
+        # the code that writes the magic has it in a literal pool too, so make sure a header follows it
+        if start + HEADER.size <= len(dump):
+            _, opcodes, trace_entries, _, _ = HEADER.unpack_from(dump, start)
+            if opcodes == 256 and trace_entries != 0:
+                candidates.append(start)
+        start += 4
+    if not candidates:
+        sys.exit('no battle script profile in the dump.  was DEBUG_BATTLE_SCRIPT_PROFILER on and a battle running?')
+    if len(candidates) > 1:
+        sys.exit('more than one profile found, pick one with --offset: ' + ', '.join(hex(c) for c in candidates))
+    return candidates[0]
+
+
+def read_profile(dump, offset):
+    magic, opcodes, trace_entries, trace_count, vm_cycles = HEADER.unpack_from(dump, offset)
+    if magic != PROFILE_MAGIC:
+        sys.exit('no battle script profile at {:#x}'.format(offset))
+    pos = offset + HEADER.size
+    counts = struct.unpack_from('<{}I'.format(opcodes), dump, pos)
+    pos += 4 * opcodes
+    cycles = struct.unpack_from('<{}Q'.format(opcodes), dump, pos)
+    pos += 8 * opcodes
+    ring = [TRACE_ENTRY.unpack_from(dump, pos + i * TRACE_ENTRY.size) for i in range(trace_entries)]
+
+    # oldest entry first
+    if trace_count > trace_entries:
+        first = trace_count % trace_entries
+        trace = ring[first:] + ring[:first]
+    else:
+        trace = ring[:trace_count]
+    return counts, cycles, trace, trace_count, vm_cycles
+
+
+def script_name(kind, index, names):
+    label, defines = names.get(kind, (str(kind), {}))
+    return '{}:{}'.format(label, defines.get(index, index))
+
+
+def script_stacks(trace, vm_cycles, names):
+    """yields (stack, cycles) for every stretch of time between two recorded script changes"""
+    stack = []
+    for i, (start, kind, depth, index, pc, _) in enumerate(trace):
+        end = trace[i + 1][0] if i + 1 < len(trace) else vm_cycles
+        # scripts pushed before the oldest entry left the ring buffer are unknown
+        stack = stack[:depth] + ['?'] * (depth - len(stack))
+        stack.append(script_name(kind, index, names))
+        yield list(stack), (end - start) & 0xFFFFFFFF
+
+
+def print_report(counts, cycles, trace, trace_count, vm_cycles, names, command_names, top):
+    total = sum(cycles) or 1
+    print('{} commands, {} cycles ({:.2f} ms) in the battle script vm'.format(
+        sum(counts), vm_cycles, vm_cycles * 1000 / BUS_CLOCK))
+    print()
+    print('top commands by cycles')
+    print('  {:<28} {:>10} {:>14} {:>10} {:>7}'.format('command', 'count', 'cycles', 'avg', '%'))
+    order = sorted((op for op in range(len(counts)) if counts[op]), key=lambda op: cycles[op], reverse=True)
+    for op in order[:top]:
+        name = command_names[op] if op < len(command_names) else ''
+        print('  {:<28} {:>10} {:>14} {:>10} {:>6.1f}%'.format(
+            '{:02X} {}'.format(op, name), counts[op], cycles[op], cycles[op] // counts[op], 100 * cycles[op] / total))
+
+    self_cycles = {}
+    runs = {}
+    for stack, spent in script_stacks(trace, vm_cycles, names):
+        self_cycles[stack[-1]] = self_cycles.get(stack[-1], 0) + spent
+        runs[stack[-1]] = runs.get(stack[-1], 0) + 1
+    traced = sum(self_cycles.values()) or 1
+    print()
+    print('top scripts by cycles, from the last {} of {} script changes'.format(len(trace), trace_count))
+    print('  {:<40} {:>8} {:>14} {:>7}'.format('script', 'runs', 'cycles', '%'))
+    for script in sorted(self_cycles, key=self_cycles.get, reverse=True)[:top]:
+        print('  {:<40} {:>8} {:>14} {:>6.1f}%'.format(
+            script, runs[script], self_cycles[script], 100 * self_cycles[script] / traced))
+
+
+def print_folded(trace, vm_cycles, names):
+    folded = {}
+    for stack, spent in script_stacks(trace, vm_cycles, names):
+        key = ';'.join(stack)
+        folded[key] = folded.get(key, 0) + spent
+    for key in sorted(folded):
+        print('{} {}'.format(key, folded[key]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='report on a battle script profile from a main ram dump')
+    parser.add_argument('dump', help='main ram dump taken during a battle')
+    parser.add_argument('--offset', type=lambda x: int(x, 0), help='offset of the profile in the dump if it can\'t be found')
+    parser.add_argument('--top', type=int, default=20, help='rows per table in the report (default 20)')
+    parser.add_argument('--folded', action='store_true', help='print folded script stacks for a flame graph instead of the report')
+    args = parser.parse_args()
+
+    with open(args.dump, 'rb') as file:
+        dump = file.read()
+
+    names = {kind: (label, read_defines(path, prefix)) for kind, (label, path, prefix) in SCRIPT_KINDS.items()}
+    counts, cycles, trace, trace_count, vm_cycles = read_profile(dump, find_profile(dump, args.offset))
+
+    if args.folded:
+        print_folded(trace, vm_cycles, names)
+    else:
+        print_report(counts, cycles, trace, trace_count, vm_cycles, names, read_command_names(BATTLE_SCRIPT_COMMANDS), args.top)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+
+# grab_overworld_ptr looks entries of gOWTagToFileNum up by tag, so a tag that
+# shows up twice would quietly hide every entry after the first.  fail the build
+# instead of letting that happen.
+#
+# the lookup is a binary search over the table's entries in tag order.  the
+# table itself keeps its order because the vanilla overlay code walks it too, so
+# this also writes that order out as a header, sOWTagOrder, for
+# overworld_table.c to include.
+
+import re
+import sys
+
+TABLE_START = re.compile(r'gOWTagToFileNum\s*\[\s*\]\s*=[^{]*\{')
+ENTRY = re.compile(r'\{([^{}]*)\}')
+TAG = re.compile(r'\s*(?:\.tag\s*=\s*)?(0x[0-9A-Fa-f]+|\d+)')
+END_OF_TABLE = 0xFFFF
+
+
+def blank_comments(text):
+    # comments become spaces so every offset still points at the same line
+    return re.sub(r'/\*.*?\*/|//[^\n]*', lambda match: re.sub(r'[^\n]', ' ', match.group(0)), text, flags=re.S)
+
+
+def read_tags(path):
+    with open(path, encoding='utf-8') as file:
+        text = blank_comments(file.read())
+
+    start = TABLE_START.search(text)
+    if start is None:
+        sys.exit('{}: gOWTagToFileNum not found'.format(path))
+    end = text.index('\n};', start.end())
+
+    tags = []
+    for entry in ENTRY.finditer(text, start.end(), end):
+        match = TAG.match(entry.group(1))
+        if match is None:
+            sys.exit('{}:{}: can\'t read the tag of this entry'.format(path, text.count('\n', 0, entry.start()) + 1))
+        tags.append((int(match.group(1), 0), text.count('\n', 0, entry.start()) + 1))
+    return tags
+
+
+def main():
+    if len(sys.argv) != 3:
+        print('Usage: check_overworld_tags.py <overworld_table.c> <tag order header>')
+        sys.exit(1)
+
+    path = sys.argv[1]
+    tags = read_tags(path)
+    if not tags or tags[-1][0] != END_OF_TABLE:
+        sys.exit('{}: gOWTagToFileNum doesn\'t end with the 0xFFFF entry'.format(path))
+    tags.pop()
+
+    seen = {}
+    errors = 0
+    for tag, lineno in tags:
+        if tag == END_OF_TABLE:
+            print('{}:{}: tag 0xFFFF is the end of table marker'.format(path, lineno))
+            errors += 1
+        elif tag in seen:
+            print('{}:{}: overworld tag {} already used on line {}'.format(path, lineno, tag, seen[tag]))
+            errors += 1
+        else:
+            seen[tag] = lineno
+
+    if errors:
+        sys.exit(1)
+
+    order = sorted(range(len(tags)), key=lambda index: tags[index][0])
+    with open(sys.argv[2], 'w', encoding='utf-8') as file:
+        file.write('// generated by scripts/check_overworld_tags.py from {}\n\n'.format(path))
+        file.write('// gOWTagToFileNum indices in tag order, for the binary search in grab_overworld_ptr\n')
+        file.write('static const u16 sOWTagOrder[{}] =\n{{\n'.format(len(order)))
+        for i in range(0, len(order), 16):
+            file.write('    ' + ', '.join(str(index) for index in order[i:i + 16]) + ',\n')
+        file.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+# builds the species -> egg move index that LoadEggMoves reads instead of searching the whole egg move list.
+#
+# input is the list armips/data/eggmoves.s assembles: for each species, a species+20000 marker halfword followed
+# by its egg moves, with 0xFFFF at the end.  output is, all little endian:
+#   u16 number of species entries
+#   u16 padding
+#   per species:  u16 halfword offset of its first egg move in the list, u16 number of egg moves
+# a species without egg moves gets offset 0 and count 0.  if a species shows up twice, the first block wins, same
+# as the search LoadEggMoves used to do.
+
+import struct
+import sys
+
+EGG_MOVE_SPECIES_MARKER = 20000
+
+
+def main():
+    if len(sys.argv) != 3:
+        print('Usage: eggmove_index.py <egg move list> <index output>')
+        sys.exit(1)
+
+    with open(sys.argv[1], 'rb') as file:
+        data = file.read()
+    halfwords = struct.unpack('<{}H'.format(len(data) // 2), data[:len(data) // 2 * 2])
+
+    index = {}
+    species = None
+    for i, value in enumerate(halfwords):
+        if value > EGG_MOVE_SPECIES_MARKER:
+            species = None
+            if value != 0xFFFF and value - EGG_MOVE_SPECIES_MARKER not in index:
+                species = value - EGG_MOVE_SPECIES_MARKER
+                index[species] = [i + 1, 0]
+        elif species is not None:
+            index[species][1] += 1
+
+    count = max(index) + 1 if index else 0
+    with open(sys.argv[2], 'wb') as file:
+        file.write(struct.pack('<HH', count, 0))
+        for species in range(count):
+            file.write(struct.pack('<HH', *index.get(species, (0, 0))))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+
+# builds the evolution index that GetMonEvolution reads instead of loading a species' evolution file every call.
+#
+# input is the directory armips/data/evodata.s assembles into, one evodata_NNNN file per species holding
+# MAX_EVOS_PER_POKE (method, param, target) halfword triples.  output is, all little endian:
+#   u16 number of species the index covers
+#   u16 number of species that evolve
+#   u16 number of evolutions in the list below
+#   u16 padding
+#   u32 bitset per 32 species, bit set if the species has at least one evolution
+#   u16 per bitset word, the number of evolving species before it
+#   u16 per evolving species plus one, the index of its first evolution in the list below.  the last one is the total
+#   the evolutions themselves, 6 bytes each in the same layout as the evolution files, EVO_NONE entries left out
+# a species without a file is treated as one without evolutions.  the game keeps the whole index in a bss buffer of
+# EVOLUTION_INDEX_MAX_SIZE bytes, so the build stops here if the index outgrows it.
+
+import os
+import re
+import struct
+import sys
+
+MAX_EVOS_PER_POKE = 9
+EVOLUTION = struct.Struct('<HHH')
+EVO_NONE = 0
+HEADER_FILE = 'include/pokemon.h'
+
+
+def read_max_size():
+    with open(HEADER_FILE) as file:
+        match = re.search(r'#define\s+EVOLUTION_INDEX_MAX_SIZE\s+\(?\s*(\w+)\s*\)?', file.read())
+    if not match:
+        sys.exit('evo_index.py: EVOLUTION_INDEX_MAX_SIZE not found in ' + HEADER_FILE)
+    return int(match.group(1), 0)
+
+
+def read_evolutions(path):
+    with open(path, 'rb') as file:
+        data = file.read(EVOLUTION.size * MAX_EVOS_PER_POKE)
+    evolutions = []
+    for i in range(len(data) // EVOLUTION.size):
+        evolution = EVOLUTION.unpack_from(data, i * EVOLUTION.size)
+        if evolution[0] != EVO_NONE:
+            evolutions.append(evolution)
+    return evolutions
+
+
+def main():
+    if len(sys.argv) != 3:
+        print('Usage: evo_index.py <evolution file directory> <index output>')
+        sys.exit(1)
+
+    species_evolutions = {}
+    for name in os.listdir(sys.argv[1]):
+        match = re.fullmatch(r'evodata_(\d+)', name)
+        if match:
+            species_evolutions[int(match.group(1))] = read_evolutions(os.path.join(sys.argv[1], name))
+
+    count = max(species_evolutions) + 1 if species_evolutions else 0
+    words = (count + 31) // 32
+    bitset = [0] * words
+    ranks = [0] * words
+    first = []
+    evolutions = []
+    for species in range(count):
+        if species % 32 == 0:
+            ranks[species // 32] = len(first)
+        if species_evolutions.get(species):
+            bitset[species // 32] |= 1 << (species % 32)
+            first.append(len(evolutions))
+            evolutions.extend(species_evolutions[species])
+    evolving = len(first)
+    first.append(len(evolutions))
+
+    if evolving > 0xFFFF or len(evolutions) > 0xFFFF:
+        sys.exit('evo_index.py: too many evolutions for a 16-bit index')
+
+    size = 8 + words * 6 + len(first) * 2 + len(evolutions) * EVOLUTION.size
+    max_size = read_max_size()
+    if size > max_size:
+        sys.exit('evo_index.py: the evolution index is {} bytes, past EVOLUTION_INDEX_MAX_SIZE ({} bytes) in {}'
+                 .format(size, max_size, HEADER_FILE))
+
+    with open(sys.argv[2], 'wb') as file:
+        file.write(struct.pack('<HHHH', count, evolving, len(evolutions), 0))
+        file.write(struct.pack('<{}I'.format(words), *bitset))
+        file.write(struct.pack('<{}H'.format(words), *ranks))
+        file.write(struct.pack('<{}H'.format(len(first)), *first))
+        for evolution in evolutions:
+            file.write(EVOLUTION.pack(*evolution))
+
+
+if __name__ == '__main__':
+    main()
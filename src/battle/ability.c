@@ -37,80 +37,6 @@ void ServerDoPostMoveEffects(void *bw, struct BattleStruct *sp);
 
 extern const u8 StatBoostModifiers[][2];
 
-const u16 SoundproofMoveList[] =
-{
-    MOVE_BOOMBURST,
-    MOVE_BUG_BUZZ,
-    MOVE_CHATTER,	
-    MOVE_CLANGING_SCALES,
-    MOVE_CLANGOROUS_SOUL,
-    //MOVE_CLANGOROUS_SOULBLAZE,
-    MOVE_CONFIDE,
-    MOVE_DISARMING_VOICE,
-    MOVE_ECHOED_VOICE,
-    MOVE_EERIE_SPELL,
-    MOVE_GRASS_WHISTLE,
-    MOVE_GROWL,
-    //MOVE_HEAL_BELL,
-    //MOVE_HOWL,
-    MOVE_HYPER_VOICE,
-    MOVE_METAL_SOUND,	
-    MOVE_NOBLE_ROAR,
-    MOVE_OVERDRIVE,
-    MOVE_PARTING_SHOT,
-    MOVE_PERISH_SONG,
-    MOVE_RELIC_SONG,
-    MOVE_ROAR,
-    MOVE_ROUND,
-    MOVE_SCREECH,
-    //MOVE_SHADOW_PANIC,
-    MOVE_SING,
-    MOVE_SNARL,
-    MOVE_SNORE,
-    MOVE_SPARKLING_ARIA,
-    MOVE_SUPERSONIC,
-    MOVE_UPROAR,
-};
-
-const u16 BulletproofMoveList[] =
-{
-    MOVE_ACID_SPRAY,
-    MOVE_AURA_SPHERE,
-    MOVE_BARRAGE,
-    MOVE_BULLET_SEED,
-    MOVE_EGG_BOMB,
-    MOVE_ELECTRO_BALL,
-    MOVE_ENERGY_BALL,
-    MOVE_FOCUS_BLAST,
-    MOVE_GYRO_BALL,
-    MOVE_ICE_BALL,
-    MOVE_MAGNET_BOMB,
-    MOVE_MIST_BALL,
-    MOVE_MUD_BOMB,
-    MOVE_OCTAZOOKA,
-    MOVE_POLLEN_PUFF,
-    MOVE_PYRO_BALL,
-    MOVE_ROCK_BLAST,
-    MOVE_ROCK_WRECKER,
-    MOVE_SEARING_SHOT,
-    MOVE_SEED_BOMB,
-    MOVE_SHADOW_BALL,
-    MOVE_SLUDGE_BOMB,
-    MOVE_WEATHER_BALL,
-    MOVE_ZAP_CANNON,
-};
-
-const u16 PowderMoveList[] = {
-    MOVE_COTTON_SPORE,
-    MOVE_MAGIC_POWDER,
-    MOVE_POISON_POWDER,
-    MOVE_POWDER,
-    MOVE_RAGE_POWDER,
-    MOVE_SLEEP_POWDER,
-    MOVE_STUN_SPORE,
-    MOVE_SPORE,
-};
-
 
 /**
  *  @brief see if the attacker's move is completely negated by the defender's ability and queue up the appropriate subscript
@@ -162,33 +88,19 @@ int MoveCheckDamageNegatingAbilities(struct BattleStruct *sp, int attacker, int
     // 02252FB0
     if (MoldBreakerAbilityCheck(sp, attacker, defender, ABILITY_SOUNDPROOF) == TRUE)
     {
+        if (MOVE_HAS_FLAG(sp->current_move_index, MOVE_FLAG_SOUNDPROOF))
         {
-            u32 i;
-
-            for (i = 0; i < NELEMS(SoundproofMoveList); i++){
-                if (SoundproofMoveList[i] == sp->current_move_index)
-                {
-                    scriptnum = SUB_SEQ_SOUNDPROOF;
-                    break;
-                }
-            }
+            scriptnum = SUB_SEQ_SOUNDPROOF;
         }
     }
 
     // Handle Bulletproof
     if (MoldBreakerAbilityCheck(sp, attacker, defender, ABILITY_BULLETPROOF) == TRUE)
     {
+        if (MOVE_HAS_FLAG(sp->current_move_index, MOVE_FLAG_BULLETPROOF))
         {
-            u32 i;
-
-            for (i = 0; i < NELEMS(BulletproofMoveList); i++){
-                if (BulletproofMoveList[i] == sp->current_move_index)
-                {
-                    // This works fine for Bulletproof too
-                    scriptnum = SUB_SEQ_SOUNDPROOF;
-                    break;
-                }
-            }
+            // This works fine for Bulletproof too
+            scriptnum = SUB_SEQ_SOUNDPROOF;
         }
     }
 
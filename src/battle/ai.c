@@ -16,6 +16,15 @@
 
 // function declarations
 void AITypeCalc(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2, u32 *flag);
+static u32 AITypeCalcWithEffectiveness(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2, u32 *flag);
+static void AIScoreMove(struct BattleStruct *sp, struct AIMoveScore *score, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2);
+static BOOL AIMoveScoreMatches(struct BattleStruct *sp, struct AIMoveScore *score, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2);
+static struct AIMoveScore *AILookUpMoveScore(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2);
+
+// AIScoreMove hands &score->flags to AITypeCalcWithEffectiveness as a u32 *, which the arm9 can't load or store at
+// an odd halfword
+_Static_assert(offsetof(struct BattleStruct, aiScoreMatrix) % 4 == 0, "aiScoreMatrix isn't word aligned in the BattleStruct");
+_Static_assert(offsetof(struct AIScoreMatrix, score) % 4 == 0 && sizeof(struct AIMoveScore) % 4 == 0, "AIMoveScore flags aren't word aligned");
 
 
 
@@ -26,21 +35,54 @@ void AITypeCalc(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int
  *  @param move index of the move being used
  *  @param atkAbility ability of the attacker
  *  @param defAbility ability of the defender
- *  @param held_effect held item effect of the attacker
+ *  @param held_effect held item effect of the defender
  *  @param type1 primary type of defender
  *  @param type2 secondary type of defender
  *  @param flag flags to modify so that the AI knows what decision to make
  */
 void AITypeCalc(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2, u32 *flag)
 {
-    int i;
-    u8 typeLocal;
+    struct AIMoveScore *score;
 
     if (move == MOVE_STRUGGLE)
     {
         return;
     }
 
+    // the ai asks about the same moves and targets over and over while it decides, so answer from the score matrix
+    // when it can.  wonder guard asks the rom about the move every time, so it is never cached
+    if (flag[0] == 0 && defAbility != ABILITY_WONDER_GUARD)
+    {
+        score = AILookUpMoveScore(sp, move, type, atkAbility, defAbility, held_effect, type1, type2);
+        if (score != NULL)
+        {
+            flag[0] = score->flags;
+            return;
+        }
+    }
+
+    AITypeCalcWithEffectiveness(sp, move, type, atkAbility, defAbility, held_effect, type1, type2, flag);
+}
+
+/**
+ *  @brief AITypeCalc's actual calculation, also working out the damage multiplier the flags stand for
+ *
+ *  @param sp global battle structure
+ *  @param move index of the move being used
+ *  @param atkAbility ability of the attacker
+ *  @param defAbility ability of the defender
+ *  @param held_effect held item effect of the defender
+ *  @param type1 primary type of defender
+ *  @param type2 secondary type of defender
+ *  @param flag flags to modify so that the AI knows what decision to make
+ *  @return damage multiplier in quarters, 0 if the move doesn't affect the defender
+ */
+static u32 AITypeCalcWithEffectiveness(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2, u32 *flag)
+{
+    int i, j, rows[2];
+    u8 typeLocal;
+    u32 effectiveness = 4;
+
     typeLocal = GetAdjustedMoveTypeBasics(sp, move, atkAbility, type); // not just normalize, now others
 
     if ((atkAbility != ABILITY_MOLD_BREAKER)
@@ -59,39 +101,15 @@ void AITypeCalc(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int
     }
     else
     {
-        i = 0;
-        while (TypeEffectivenessTable[i][0] != 0xff)
+        GetTypeEffectivenessRows(typeLocal, type1, type2, (atkAbility == ABILITY_SCRAPPY), rows);
+        for (j = 0; j < 2; j++)
         {
-            if (TypeEffectivenessTable[i][0] == 0xfe)
-            {
-                if (atkAbility == ABILITY_SCRAPPY)
-                {
-                    break;
-                }
-                else
-                {
-                    i++;
-                    continue;
-                }
-            }
-            if (TypeEffectivenessTable[i][0] == typeLocal)
+            i = rows[j];
+            if (i >= 0 && AI_ShouldUseNormalTypeEffCalc(sp, held_effect, i) == TRUE)
             {
-                if (TypeEffectivenessTable[i][1] == type1)
-                {
-                    if (AI_ShouldUseNormalTypeEffCalc(sp, held_effect, i) == TRUE)
-                    {
-                        AI_TypeCheckCalc(TypeEffectivenessTable[i][2], flag);
-                    }
-                }
-                if ((TypeEffectivenessTable[i][1] == type2) && (type1 != type2)) // haven't already run the type yet
-                {
-                    if (AI_ShouldUseNormalTypeEffCalc(sp, held_effect, i) == TRUE)
-                    {
-                        AI_TypeCheckCalc(TypeEffectivenessTable[i][2], flag);
-                    }
-                }
+                AI_TypeCheckCalc(TypeEffectivenessTable[i][2], flag);
+                effectiveness = effectiveness * TypeEffectivenessTable[i][2] / 10;
             }
-            i++;
         }
     }
 
@@ -103,5 +121,169 @@ void AITypeCalc(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int
         flag[0] |= MOVE_STATUS_FLAG_NOT_EFFECTIVE; // not "not very effective", ineffective
     }
 
-    return;
+    if (flag[0] & MOVE_STATUS_FLAG_NOT_EFFECTIVE)
+    {
+        effectiveness = 0;
+    }
+
+    return effectiveness;
+}
+
+/**
+ *  @brief work out one entry of a score matrix and remember the arguments it was worked out for
+ *
+ *  @param sp global battle structure
+ *  @param score entry to fill
+ *  @param move index of the move being used
+ *  @see AITypeCalc for the rest
+ */
+static void AIScoreMove(struct BattleStruct *sp, struct AIMoveScore *score, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2)
+{
+    score->flags = 0;
+    score->effectiveness = AITypeCalcWithEffectiveness(sp, move, type, atkAbility, defAbility, held_effect, type1, type2, &score->flags);
+    score->valid = TRUE;
+    score->type = type;
+    score->type1 = type1;
+    score->type2 = type2;
+    score->gravity = ((sp->field_condition & FIELD_STATUS_GRAVITY) != 0);
+    score->atk_ability = atkAbility;
+    score->def_ability = defAbility;
+    score->held_effect = held_effect;
+    score->current_move = sp->current_move_index;
+}
+
+/**
+ *  @brief check if a score matrix entry was worked out for these AITypeCalc arguments
+ *
+ *  @param sp global battle structure
+ *  @param score entry to check
+ *  @see AITypeCalc for the rest
+ *  @return TRUE if the entry can answer for these arguments
+ */
+static BOOL AIMoveScoreMatches(struct BattleStruct *sp, struct AIMoveScore *score, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2)
+{
+    return (score->valid
+         && score->type == type
+         && score->type1 == type1
+         && score->type2 == type2
+         && score->gravity == ((sp->field_condition & FIELD_STATUS_GRAVITY) != 0)
+         && score->atk_ability == atkAbility
+         && score->def_ability == defAbility
+         && score->held_effect == held_effect
+         && score->current_move == sp->current_move_index);
+}
+
+/**
+ *  @brief find the score matrix entry for the move and target the AI is thinking about, scoring the attacker's
+ *         moves against that target first if this turn's matrix doesn't have them yet
+ *
+ *  @param sp global battle structure
+ *  @param move index of the move being used
+ *  @see AITypeCalc for the rest
+ *  @return entry for these arguments, NULL if the move isn't one of the attacker's
+ */
+static struct AIMoveScore *AILookUpMoveScore(struct BattleStruct *sp, u32 move, u32 type, int atkAbility, int defAbility, int held_effect, int type1, int type2)
+{
+    u32 attacker = sp->aiWorkTable.ai_attack_client;
+    u32 defender = sp->aiWorkTable.ai_defence_client;
+    struct AIScoreMatrix *matrix;
+    struct AIMoveScore *score;
+    int i;
+
+    if (attacker >= CLIENT_MAX || defender >= CLIENT_MAX || attacker == defender)
+    {
+        return NULL;
+    }
+
+    matrix = &sp->aiScoreMatrix[attacker];
+    if (!matrix->built || matrix->turn != sp->total_turn || (matrix->targets & (1 << defender)) == 0)
+    {
+        AIEvaluateMoves(sp, attacker, defender);
+    }
+
+    for (i = 0; i < 4; i++)
+    {
+        if (matrix->move[i] == move)
+        {
+            break;
+        }
+    }
+    if (i == 4)
+    {
+        return NULL;
+    }
+
+    // GetAdjustedMoveTypeBasics reads a type of 0 as the move's own type, so both ask for the same entry
+    if (type == 0)
+    {
+        type = sp->moveTbl[move].type;
+    }
+
+    // the ai sometimes asks "what if", e.g. about another ability or hidden power's real type, so an entry that
+    // doesn't match is worked out again
+    score = &matrix->score[i][defender];
+    if (!AIMoveScoreMatches(sp, score, type, atkAbility, defAbility, held_effect, type1, type2))
+    {
+        AIScoreMove(sp, score, move, type, atkAbility, defAbility, held_effect, type1, type2);
+    }
+    return score;
+}
+
+/**
+ *  @brief score all of an AI battler's moves against one target in one pass, working the attacker's ability and the
+ *         target's ability and held item out once.  AITypeCalc answers from the result while it lasts
+ *
+ *  @param sp global battle structure
+ *  @param attacker AI battler to score the moves of
+ *  @param defender battler to score them against.  AI_ShouldUseNormalTypeEffCalc and
+ *                  ShouldDelayTurnEffectivenessChecking read the battlers the AI is looking at out of sp, so this has
+ *                  to be sp->aiWorkTable.ai_defence_client
+ *  @return sp->aiScoreMatrix[attacker], with the defender's column filled
+ */
+const struct AIScoreMatrix *AIEvaluateMoves(struct BattleStruct *sp, int attacker, int defender)
+{
+    struct AIScoreMatrix *matrix = &sp->aiScoreMatrix[attacker];
+    int i, atkAbility, defAbility, held_effect;
+
+    if (!matrix->built || matrix->turn != sp->total_turn)
+    {
+        memset(matrix, 0, sizeof(*matrix));
+        matrix->built = TRUE;
+        matrix->turn = sp->total_turn;
+        for (i = 0; i < 4; i++)
+        {
+            matrix->move[i] = sp->battlemon[attacker].move[i];
+        }
+    }
+
+    atkAbility = GetBattlerAbility(sp, attacker);
+    defAbility = GetBattlerAbility(sp, defender);
+    held_effect = HeldItemHoldEffectGet(sp, defender);
+    for (i = 0; i < 4; i++)
+    {
+        // scored with the move's own type, the one the ai passes for every move that doesn't change type
+        if (matrix->move[i] != MOVE_NONE && matrix->move[i] != MOVE_STRUGGLE)
+        {
+            AIScoreMove(sp, &matrix->score[i][defender], matrix->move[i], sp->moveTbl[matrix->move[i]].type, atkAbility,
+                        defAbility, held_effect, sp->battlemon[defender].type1, sp->battlemon[defender].type2);
+        }
+    }
+    matrix->targets |= 1 << defender;
+
+    return matrix;
+}
+
+/**
+ *  @brief throw away every AIScoreMatrix so the next AI decision scores moves against the battle as it is now
+ *
+ *  @param sp global battle structure
+ */
+void AIClearScoreMatrices(struct BattleStruct *sp)
+{
+    int i;
+
+    for (i = 0; i < CLIENT_MAX; i++)
+    {
+        sp->aiScoreMatrix[i].built = FALSE;
+    }
 }
@@ -21,24 +21,6 @@ int AdjustDamageForRoll(void *bw, struct BattleStruct *sp, int damage);
 
 
 
-struct __attribute__((packed)) sDamageCalc
-{
-    u16 species;
-    s16 hp;
-    u16 maxhp;
-    u16 dummy;
-    int item_held_effect;
-    int item_power;
-
-    u32 condition;
-
-    u16 ability;
-    u8 sex;
-    u8 type1;
-    u8 type2;
-};
-
-
 static const u8 HeldItemPowerUpTable[][2]={
     {HOLD_EFFECT_BOOST_BUG, TYPE_BUG},
     {HOLD_EFFECT_BOOST_STEEL, TYPE_STEEL},
@@ -79,83 +61,6 @@ static const u8 HeldItemPowerUpTable[][2]={
 #endif
 };
 
-static const u16 IronFistMovesTable[] = {
-    MOVE_BULLET_PUNCH,
-    MOVE_COMET_PUNCH,
-    MOVE_DIZZY_PUNCH,
-    MOVE_DOUBLE_IRON_BASH,
-    MOVE_DRAIN_PUNCH,
-    MOVE_DYNAMIC_PUNCH,
-    MOVE_FIRE_PUNCH,
-    MOVE_FOCUS_PUNCH,
-    MOVE_HAMMER_ARM,
-    MOVE_HEADLONG_RUSH,
-    MOVE_ICE_HAMMER,
-    MOVE_ICE_PUNCH,
-    MOVE_JET_PUNCH,
-    MOVE_MACH_PUNCH,
-    MOVE_MEGA_PUNCH,
-    MOVE_METEOR_MASH,
-    MOVE_PLASMA_FISTS,
-    MOVE_POWER_UP_PUNCH,
-    MOVE_RAGE_FIST,
-    MOVE_SHADOW_PUNCH,
-    MOVE_SKY_UPPERCUT,
-    MOVE_SURGING_STRIKES,
-    MOVE_THUNDER_PUNCH,
-    MOVE_WICKED_BLOW,
-};
-
-static const u16 StrongJawMovesTable[] = {
-        MOVE_BITE,
-        MOVE_CRUNCH,
-        MOVE_FIRE_FANG,
-        MOVE_FISHIOUS_REND,
-        MOVE_HYPER_FANG,
-        MOVE_ICE_FANG,
-        MOVE_JAW_LOCK,
-        MOVE_POISON_FANG,
-        MOVE_PSYCHIC_FANGS,
-        MOVE_THUNDER_FANG,
-};
-
-static const u16 MegaLauncherMovesTable[] = {
-        MOVE_AURA_SPHERE,
-        MOVE_DARK_PULSE,
-        MOVE_DRAGON_PULSE,
-        MOVE_HEAL_PULSE,
-        MOVE_ORIGIN_PULSE,
-        MOVE_TERRAIN_PULSE,
-        MOVE_WATER_PULSE,
-};
-
-static const u16 SharpnessMovesTable[] = {
-        MOVE_AERIAL_ACE,
-        MOVE_AIR_CUTTER,
-        MOVE_AIR_SLASH,
-        MOVE_AQUA_CUTTER,
-        MOVE_BEHEMOTH_BLADE,
-        MOVE_BITTER_BLADE,
-        MOVE_CEASELESS_EDGE,
-        MOVE_CROSS_POISON,
-        MOVE_CUT,
-        MOVE_FURY_CUTTER,
-        MOVE_KOWTOW_CLEAVE,
-        MOVE_LEAF_BLADE,
-        MOVE_NIGHT_SLASH,
-        MOVE_POPULATION_BOMB,
-        MOVE_PSYBLADE,
-        MOVE_PSYCHO_CUT,
-        MOVE_RAZOR_SHELL,
-        MOVE_RAZOR_LEAF,
-        MOVE_SACRED_SWORD,
-        MOVE_SECRET_SWORD,
-        MOVE_SLASH,
-        MOVE_SOLAR_BLADE,
-        MOVE_STONE_AXE,
-        MOVE_X_SCISSOR,
-};
-
 const u8 StatBoostModifiers[][2] = {
          // numerator, denominator
         {          10,          40 },
@@ -191,49 +96,26 @@ int CalcBaseDamage(void *bw, struct BattleStruct *sp, int moveno, u32 side_cond,
     s8 spdefstate;
     u8 level;
     u16 movepower;
-    u16 item;
     u32 battle_type;
 
 
-    struct sDamageCalc AttackingMon;
-    struct sDamageCalc DefendingMon;
-
-    attack = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_ATK, NULL);
-    defense = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_DEF, NULL);
-    sp_attack = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_SPATK, NULL);
-    sp_defense = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_SPDEF, NULL);
-
-    atkstate = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_STATE_ATK, NULL) - 6;
-    defstate = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_STATE_DEF, NULL) - 6;
-    spatkstate = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_STATE_SPATK, NULL) - 6;
-    spdefstate = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_STATE_SPDEF, NULL) - 6;
-
-    level = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_LEVEL, NULL);
-
-    AttackingMon.species = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_SPECIES, NULL);
-    DefendingMon.species = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_SPECIES, NULL);
-    AttackingMon.hp = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_HP, NULL);
-    DefendingMon.hp = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_HP, NULL);
-    AttackingMon.maxhp = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_MAX_HP, NULL);
-    DefendingMon.maxhp = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_MAX_HP, NULL);
-    AttackingMon.condition = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_MAX_CONDITION, NULL);
-    DefendingMon.condition = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_MAX_CONDITION, NULL);
-    AttackingMon.ability = GetBattlerAbility(sp, attacker);
-    DefendingMon.ability = GetBattlerAbility(sp, defender);
-    AttackingMon.sex = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_SEX, NULL);
-    DefendingMon.sex = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_SEX, NULL);
-    AttackingMon.type1 = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_TYPE1, NULL);
-    DefendingMon.type1 = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_TYPE1, NULL);
-    AttackingMon.type2 = BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_TYPE2, NULL);
-    DefendingMon.type2 = BattlePokemonParamGet(sp, defender, BATTLE_MON_DATA_TYPE2, NULL);
-
-    item = GetBattleMonItem(sp, attacker);
-    AttackingMon.item_held_effect = BattleItemDataGet(sp, item, 1);
-    AttackingMon.item_power = BattleItemDataGet(sp, item, 2);
-
-    item = GetBattleMonItem(sp, defender);
-    DefendingMon.item_held_effect = BattleItemDataGet(sp, item, 1);
-    DefendingMon.item_power = BattleItemDataGet(sp, item, 2);
+    struct BattlerCalcSnapshot AttackingMon;
+    struct BattlerCalcSnapshot DefendingMon;
+
+    FillBattlerCalcSnapshot(sp, attacker, &AttackingMon);
+    FillBattlerCalcSnapshot(sp, defender, &DefendingMon);
+
+    attack = AttackingMon.attack;
+    defense = DefendingMon.defense;
+    sp_attack = AttackingMon.spatk;
+    sp_defense = DefendingMon.spdef;
+
+    atkstate = AttackingMon.states[STAT_ATTACK] - 6;
+    defstate = DefendingMon.states[STAT_DEFENSE] - 6;
+    spatkstate = AttackingMon.states[STAT_SPATK] - 6;
+    spdefstate = DefendingMon.states[STAT_SPDEF] - 6;
+
+    level = AttackingMon.level;
 
     battle_type = BattleTypeGet(bw);
 
@@ -388,7 +270,7 @@ int CalcBaseDamage(void *bw, struct BattleStruct *sp, int moveno, u32 side_cond,
 
     if ((AttackingMon.item_held_effect == HOLD_EFFECT_GRISEOUS_ORB) &&
         ((movetype == TYPE_DRAGON) || (movetype == TYPE_GHOST)) &&
-        ((BattlePokemonParamGet(sp, attacker, BATTLE_MON_DATA_STATUS2, NULL) & STATUS2_FLAG_TRANSFORMED) == 0) &&
+        ((AttackingMon.condition2 & STATUS2_FLAG_TRANSFORMED) == 0) &&
         (AttackingMon.species == SPECIES_GIRATINA))
     {
         movepower = movepower * (100 + AttackingMon.item_power) / 100;
@@ -512,25 +394,25 @@ int CalcBaseDamage(void *bw, struct BattleStruct *sp, int moveno, u32 side_cond,
     }
 
     //handle steelworker
-    if(GetBattlerAbility(sp, attacker) == ABILITY_STEELWORKER && (movetype == TYPE_STEEL))
+    if(AttackingMon.ability == ABILITY_STEELWORKER && (movetype == TYPE_STEEL))
     {
         movepower = movepower * 150 / 100;
     }
 
     //handle dragon's maw
-    if(GetBattlerAbility(sp, attacker) == ABILITY_DRAGONS_MAW && (movetype == TYPE_DRAGON))
+    if(AttackingMon.ability == ABILITY_DRAGONS_MAW && (movetype == TYPE_DRAGON))
     {
         movepower = movepower * 150 / 100;
     }
 
     //handle transistor
-    if(GetBattlerAbility(sp, attacker) == ABILITY_TRANSISTOR && (movetype == TYPE_ELECTRIC))
+    if(AttackingMon.ability == ABILITY_TRANSISTOR && (movetype == TYPE_ELECTRIC))
     {
         movepower = movepower * 150 / 100;
     }
 
     //handle rocky payload
-    if(GetBattlerAbility(sp, attacker) == ABILITY_ROCKY_PAYLOAD && (movetype == TYPE_ROCK))
+    if(AttackingMon.ability == ABILITY_ROCKY_PAYLOAD && (movetype == TYPE_ROCK))
     {
         movepower = movepower * 150 / 100;
     }
@@ -582,31 +464,31 @@ int CalcBaseDamage(void *bw, struct BattleStruct *sp, int moveno, u32 side_cond,
     }
 
     // handle aerilate - 20% boost if a normal type move was changed to a flying type move.  does not boost flying type moves themselves
-    if (GetBattlerAbility(sp, attacker) == ABILITY_AERILATE && movetype == TYPE_FLYING && sp->moveTbl[moveno].type == TYPE_NORMAL)
+    if (AttackingMon.ability == ABILITY_AERILATE && movetype == TYPE_FLYING && sp->moveTbl[moveno].type == TYPE_NORMAL)
     {
         movepower = movepower * 120 / 100;
     }
 
     // handle pixilate - 20% boost if a normal type move was changed to a fairy type move.  does not boost fairy type moves themselves
-    if (GetBattlerAbility(sp, attacker) == ABILITY_PIXILATE && movetype == TYPE_FAIRY && sp->moveTbl[moveno].type == TYPE_NORMAL)
+    if (AttackingMon.ability == ABILITY_PIXILATE && movetype == TYPE_FAIRY && sp->moveTbl[moveno].type == TYPE_NORMAL)
     {
         movepower = movepower * 120 / 100;
     }
 
     // handle galvanize - 20% boost if a normal type move was changed to an electric type move.  does not boost electric type moves themselves
-    if (GetBattlerAbility(sp, attacker) == ABILITY_GALVANIZE && movetype == TYPE_ELECTRIC && sp->moveTbl[moveno].type == TYPE_NORMAL)
+    if (AttackingMon.ability == ABILITY_GALVANIZE && movetype == TYPE_ELECTRIC && sp->moveTbl[moveno].type == TYPE_NORMAL)
     {
         movepower = movepower * 120 / 100;
     }
 
     // handle refrigerate - 20% boost if a normal type move was changed to an ice type move.  does not boost ice type moves themselves
-    if (GetBattlerAbility(sp, attacker) == ABILITY_REFRIGERATE && movetype == TYPE_ICE && sp->moveTbl[moveno].type == TYPE_NORMAL)
+    if (AttackingMon.ability == ABILITY_REFRIGERATE && movetype == TYPE_ICE && sp->moveTbl[moveno].type == TYPE_NORMAL)
     {
         movepower = movepower * 120 / 100;
     }
 
     // handle normalize - 20% boost if a normal type move is used (and it changes types to normal too)
-    if (GetBattlerAbility(sp, attacker) == ABILITY_NORMALIZE && movetype == TYPE_NORMAL)
+    if (AttackingMon.ability == ABILITY_NORMALIZE && movetype == TYPE_NORMAL)
     {
         movepower = movepower * 120 / 100;
     }
@@ -700,43 +582,27 @@ int CalcBaseDamage(void *bw, struct BattleStruct *sp, int moveno, u32 side_cond,
     }
 
     // handle iron fist
-    for (i = 0; i < NELEMS(IronFistMovesTable); i++)
+    if ((AttackingMon.ability == ABILITY_IRON_FIST) && MOVE_HAS_FLAG(moveno, MOVE_FLAG_IRON_FIST))
     {
-        if ((IronFistMovesTable[i] == moveno) && (AttackingMon.ability == ABILITY_IRON_FIST))
-        {
-            movepower = movepower * 12 / 10;
-            break;
-        }
+        movepower = movepower * 12 / 10;
     }
 
     // handle strong jaw
-    for (i = 0; i < NELEMS(StrongJawMovesTable); i++)
+    if ((AttackingMon.ability == ABILITY_STRONG_JAW) && MOVE_HAS_FLAG(moveno, MOVE_FLAG_STRONG_JAW))
     {
-        if ((StrongJawMovesTable[i] == moveno) && (AttackingMon.ability == ABILITY_STRONG_JAW))
-        {
-            movepower = movepower * 15 / 10;
-            break;
-        }
+        movepower = movepower * 15 / 10;
     }
 
     // handle mega launcher
-    for (i = 0; i < NELEMS(MegaLauncherMovesTable); i++)
+    if ((AttackingMon.ability == ABILITY_MEGA_LAUNCHER) && MOVE_HAS_FLAG(moveno, MOVE_FLAG_MEGA_LAUNCHER))
     {
-        if ((MegaLauncherMovesTable[i] == moveno) && (AttackingMon.ability == ABILITY_MEGA_LAUNCHER))
-        {
-            movepower = movepower * 15 / 10;
-            break;
-        }
+        movepower = movepower * 15 / 10;
     }
 
     // handle sharpness
-    for (i = 0; i < NELEMS(SharpnessMovesTable); i++)
+    if ((AttackingMon.ability == ABILITY_SHARPNESS) && MOVE_HAS_FLAG(moveno, MOVE_FLAG_SHARPNESS))
     {
-        if ((SharpnessMovesTable[i] == moveno) && (AttackingMon.ability == ABILITY_SHARPNESS))
-        {
-            movepower = movepower * 15 / 10;
-            break;
-        }
+        movepower = movepower * 15 / 10;
     }
 
     //handles water bubble
@@ -769,7 +635,7 @@ int CalcBaseDamage(void *bw, struct BattleStruct *sp, int moveno, u32 side_cond,
             attack = attack * 15 / 10;
         }
         if ((field_cond & WEATHER_SUNNY_ANY) &&
-            (GetBattlerAbility(sp, attacker) != ABILITY_MOLD_BREAKER) &&
+            (AttackingMon.ability != ABILITY_MOLD_BREAKER) &&
             (CheckSideAbility(bw, sp, CHECK_PLAYER_SIDE_ALIVE, defender, ABILITY_FLOWER_GIFT)))
         {
             sp_defense = sp_defense * 15 / 10;
@@ -1033,6 +899,45 @@ u16 GetBattleMonItem(struct BattleStruct *sp, int client_no)
 }
 
 
+/**
+ *  @brief fill a BattlerCalcSnapshot with a battler's current state.  it is not kept up to date, so fill it again
+ *         after anything that may change the battler
+ *
+ *  @param sp global battle structure
+ *  @param client_no battler to take the snapshot of
+ *  @param snapshot snapshot to fill
+ */
+void FillBattlerCalcSnapshot(struct BattleStruct *sp, int client_no, struct BattlerCalcSnapshot *snapshot)
+{
+    struct BattlePokemon *mon = &sp->battlemon[client_no];
+    int i;
+
+    snapshot->species = mon->species;
+    snapshot->hp = mon->hp;
+    snapshot->maxhp = mon->maxhp;
+    snapshot->attack = mon->attack;
+    snapshot->defense = mon->defense;
+    snapshot->speed = mon->speed;
+    snapshot->spatk = mon->spatk;
+    snapshot->spdef = mon->spdef;
+    for (i = 0; i < STAT_MAX; i++)
+    {
+        snapshot->states[i] = mon->states[i];
+    }
+    snapshot->level = mon->level;
+    snapshot->sex = mon->sex;
+    snapshot->type1 = mon->type1;
+    snapshot->type2 = mon->type2;
+    snapshot->condition = mon->condition;
+    snapshot->condition2 = mon->condition2;
+
+    snapshot->ability = GetBattlerAbility(sp, client_no);
+    snapshot->item = GetBattleMonItem(sp, client_no);
+    snapshot->item_held_effect = BattleItemDataGet(sp, snapshot->item, 1);
+    snapshot->item_power = BattleItemDataGet(sp, snapshot->item, 2);
+}
+
+
 /**
  *  @brief calculate overall damage, accounting for critical hits and me first boosts.  passed into damage roller below
  *
@@ -32,162 +32,107 @@ ALIGN4 struct ILLUSION_STRUCT gIllusionStruct = {0};
  *         format is move type, defending type, and effectiveness
  *         0 is ineffective, 5 is not very effective, 20 is super effective
  *         every entry after the 0xFE entry is ignored by foresight
+ *         the entries themselves live in type_effectiveness.h so the lookup matrices below can't drift from it
  */
 u8 TypeEffectivenessTable[][3] =
 {
-    { TYPE_NORMAL, TYPE_ROCK, 0x05 },
-    { TYPE_NORMAL, TYPE_STEEL, 0x05 },
-    { TYPE_FIGHTING, TYPE_NORMAL, 0x14 },
-    { TYPE_FIGHTING, TYPE_FLYING, 0x05 },
-    { TYPE_FIGHTING, TYPE_POISON, 0x05 },
-    { TYPE_FIGHTING, TYPE_ROCK, 0x14 },
-    { TYPE_FIGHTING, TYPE_BUG, 0x05 },
-    { TYPE_FIGHTING, TYPE_STEEL, 0x14 },
-
-#if FAIRY_TYPE_IMPLEMENTED == 1
-    { TYPE_FIGHTING, TYPE_FAIRY, 0x05 },
-#endif
-
-    { TYPE_FIGHTING, TYPE_PSYCHIC, 0x05 },
-    { TYPE_FIGHTING, TYPE_ICE, 0x14 },
-    { TYPE_FIGHTING, TYPE_DARK, 0x14 },
-    { TYPE_FLYING, TYPE_FIGHTING, 0x14 },
-    { TYPE_FLYING, TYPE_ROCK, 0x05 },
-    { TYPE_FLYING, TYPE_BUG, 0x14 },
-    { TYPE_FLYING, TYPE_STEEL, 0x05 },
-    { TYPE_FLYING, TYPE_GRASS, 0x14 },
-    { TYPE_FLYING, TYPE_ELECTRIC, 0x05 },
-    { TYPE_POISON, TYPE_POISON, 0x05 },
-    { TYPE_POISON, TYPE_GROUND, 0x05 },
-    { TYPE_POISON, TYPE_ROCK, 0x05 },
-    { TYPE_POISON, TYPE_GHOST, 0x05 },
-    { TYPE_POISON, TYPE_STEEL, 0x00 },
-
-#if FAIRY_TYPE_IMPLEMENTED == 1
-    { TYPE_POISON, TYPE_FAIRY, 0x14 },
-#endif
-
-    { TYPE_POISON, TYPE_GRASS, 0x14 },
-    { TYPE_GROUND, TYPE_FLYING, 0x00 },
-    { TYPE_GROUND, TYPE_POISON, 0x14 },
-    { TYPE_GROUND, TYPE_ROCK, 0x14 },
-    { TYPE_GROUND, TYPE_BUG, 0x05 },
-    { TYPE_GROUND, TYPE_STEEL, 0x14 },
-    { TYPE_GROUND, TYPE_FIRE, 0x14 },
-    { TYPE_GROUND, TYPE_GRASS, 0x05 },
-    { TYPE_GROUND, TYPE_ELECTRIC, 0x14 },
-    { TYPE_ROCK, TYPE_FIGHTING, 0x05 },
-    { TYPE_ROCK, TYPE_FLYING, 0x14 },
-    { TYPE_ROCK, TYPE_GROUND, 0x05 },
-    { TYPE_ROCK, TYPE_BUG, 0x14 },
-    { TYPE_ROCK, TYPE_STEEL, 0x05 },
-    { TYPE_ROCK, TYPE_FIRE, 0x14 },
-    { TYPE_ROCK, TYPE_ICE, 0x14 },
-    { TYPE_BUG, TYPE_FIGHTING, 0x05 },
-    { TYPE_BUG, TYPE_FLYING, 0x05 },
-    { TYPE_BUG, TYPE_POISON, 0x05 },
-    { TYPE_BUG, TYPE_GHOST, 0x05 },
-    { TYPE_BUG, TYPE_STEEL, 0x05 },
-
-#if FAIRY_TYPE_IMPLEMENTED == 1
-    { TYPE_BUG, TYPE_FAIRY, 0x05 },
-#endif
-
-    { TYPE_BUG, TYPE_FIRE, 0x05 },
-    { TYPE_BUG, TYPE_GRASS, 0x14 },
-    { TYPE_BUG, TYPE_PSYCHIC, 0x14 },
-    { TYPE_BUG, TYPE_DARK, 0x14 },
-    { TYPE_GHOST, TYPE_NORMAL, 0x00 },
-    { TYPE_GHOST, TYPE_GHOST, 0x14 },
-    { TYPE_GHOST, TYPE_PSYCHIC, 0x14 },
-    { TYPE_GHOST, TYPE_DARK, 0x05 },
-    { TYPE_STEEL, TYPE_ROCK, 0x14 },
-    { TYPE_STEEL, TYPE_STEEL, 0x05 },
-
-#if FAIRY_TYPE_IMPLEMENTED == 1
-    { TYPE_STEEL, TYPE_FAIRY, 0x14 },
-#endif
-
-    { TYPE_STEEL, TYPE_FIRE, 0x05 },
-    { TYPE_STEEL, TYPE_WATER, 0x05 },
-    { TYPE_STEEL, TYPE_ELECTRIC, 0x05 },
-    { TYPE_STEEL, TYPE_ICE, 0x14 },
-    { TYPE_STEEL, TYPE_DARK, 0x0A },
-
-#if FAIRY_TYPE_IMPLEMENTED == 1
-    { TYPE_FAIRY, TYPE_FIGHTING, 0x14 },
-    { TYPE_FAIRY, TYPE_POISON, 0x05 },
-    { TYPE_FAIRY, TYPE_STEEL, 0x05 },
-    { TYPE_FAIRY, TYPE_FIRE, 0x05 },
-    { TYPE_FAIRY, TYPE_DRAGON, 0x14 },
-    { TYPE_FAIRY, TYPE_DARK, 0x14 },
-#endif
-
-    { TYPE_FIRE, TYPE_ROCK, 0x05 },
-    { TYPE_FIRE, TYPE_BUG, 0x14 },
-    { TYPE_FIRE, TYPE_STEEL, 0x14 },
-    { TYPE_FIRE, TYPE_FIRE, 0x05 },
-    { TYPE_FIRE, TYPE_WATER, 0x05 },
-    { TYPE_FIRE, TYPE_GRASS, 0x14 },
-    { TYPE_FIRE, TYPE_ICE, 0x14 },
-    { TYPE_FIRE, TYPE_DRAGON, 0x05 },
-    { TYPE_WATER, TYPE_GROUND, 0x14 },
-    { TYPE_WATER, TYPE_ROCK, 0x14 },
-    { TYPE_WATER, TYPE_FIRE, 0x14 },
-    { TYPE_WATER, TYPE_WATER, 0x05 },
-    { TYPE_WATER, TYPE_GRASS, 0x05 },
-    { TYPE_WATER, TYPE_DRAGON, 0x05 },
-    { TYPE_GRASS, TYPE_FLYING, 0x05 },
-    { TYPE_GRASS, TYPE_POISON, 0x05 },
-    { TYPE_GRASS, TYPE_GROUND, 0x14 },
-    { TYPE_GRASS, TYPE_ROCK, 0x14 },
-    { TYPE_GRASS, TYPE_BUG, 0x05 },
-    { TYPE_GRASS, TYPE_STEEL, 0x05 },
-    { TYPE_GRASS, TYPE_FIRE, 0x05 },
-    { TYPE_GRASS, TYPE_WATER, 0x14 },
-    { TYPE_GRASS, TYPE_GRASS, 0x05 },
-    { TYPE_GRASS, TYPE_DRAGON, 0x05 },
-    { TYPE_ELECTRIC, TYPE_FLYING, 0x14 },
-    { TYPE_ELECTRIC, TYPE_GROUND, 0x00 },
-    { TYPE_ELECTRIC, TYPE_WATER, 0x14 },
-    { TYPE_ELECTRIC, TYPE_GRASS, 0x05 },
-    { TYPE_ELECTRIC, TYPE_ELECTRIC, 0x05 },
-    { TYPE_ELECTRIC, TYPE_DRAGON, 0x05 },
-    { TYPE_PSYCHIC, TYPE_FIGHTING, 0x14 },
-    { TYPE_PSYCHIC, TYPE_POISON, 0x14 },
-    { TYPE_PSYCHIC, TYPE_STEEL, 0x05 },
-    { TYPE_PSYCHIC, TYPE_PSYCHIC, 0x05 },
-    { TYPE_PSYCHIC, TYPE_DARK, 0x00 },
-    { TYPE_ICE, TYPE_FLYING, 0x14 },
-    { TYPE_ICE, TYPE_GROUND, 0x14 },
-    { TYPE_ICE, TYPE_STEEL, 0x05 },
-    { TYPE_ICE, TYPE_FIRE, 0x05 },
-    { TYPE_ICE, TYPE_WATER, 0x05 },
-    { TYPE_ICE, TYPE_GRASS, 0x14 },
-    { TYPE_ICE, TYPE_ICE, 0x05 },
-    { TYPE_ICE, TYPE_DRAGON, 0x14 },
-    { TYPE_DRAGON, TYPE_STEEL, 0x05 },
-
-#if FAIRY_TYPE_IMPLEMENTED == 1
-    { TYPE_DRAGON, TYPE_FAIRY, 0x00 },
-#endif
-
-    { TYPE_DRAGON, TYPE_DRAGON, 0x14 },
-    { TYPE_DARK, TYPE_FIGHTING, 0x05 },
-    { TYPE_DARK, TYPE_GHOST, 0x14 },
-
-#if FAIRY_TYPE_IMPLEMENTED == 1
-    { TYPE_DARK, TYPE_FAIRY, 0x05 },
-#endif
-
-    { TYPE_DARK, TYPE_PSYCHIC, 0x14 },
-    { TYPE_DARK, TYPE_DARK, 0x05 },
+#define TYPE_EFF(atk, def, mult) { atk, def, mult },
+#define TYPE_EFF_FORESIGHT(atk, def, mult)
+#include "../../include/type_effectiveness.h"
+#undef TYPE_EFF
+#undef TYPE_EFF_FORESIGHT
     { 0xFE, 0xFE, 0x00 },
-    { TYPE_NORMAL, TYPE_GHOST, 0x00 },
-    { TYPE_FIGHTING, TYPE_GHOST, 0x00 },
+#define TYPE_EFF(atk, def, mult)
+#define TYPE_EFF_FORESIGHT(atk, def, mult) { atk, def, mult },
+#include "../../include/type_effectiveness.h"
+#undef TYPE_EFF
+#undef TYPE_EFF_FORESIGHT
     { 0xFF, 0xFF, 0xFF },
 };
 
+// TypeEffectivenessTable row of every entry, in the same order as above.
+// listing a pair twice redeclares its enumerator, so duplicates fail to build.
+enum
+{
+#define TYPE_EFF(atk, def, mult) TYPE_EFF_ROW_##atk##_##def,
+#define TYPE_EFF_FORESIGHT(atk, def, mult)
+#include "../../include/type_effectiveness.h"
+#undef TYPE_EFF
+#undef TYPE_EFF_FORESIGHT
+    TYPE_EFF_ROW_FORESIGHT,
+#define TYPE_EFF(atk, def, mult)
+#define TYPE_EFF_FORESIGHT(atk, def, mult) TYPE_EFF_ROW_##atk##_##def,
+#include "../../include/type_effectiveness.h"
+#undef TYPE_EFF
+#undef TYPE_EFF_FORESIGHT
+};
+
+/**
+ *  @brief TypeEffectivenessTable row + 1 for each move type and defending type, 0 if the matchup is neutral.
+ *         TypeEffectivenessForesightOverlay holds the rows past the 0xFE entry that foresight and scrappy skip
+ */
+static const u8 TypeEffectivenessMatrix[NUM_TYPES][NUM_TYPES] =
+{
+#define TYPE_EFF(atk, def, mult) [atk][def] = TYPE_EFF_ROW_##atk##_##def + 1,
+#define TYPE_EFF_FORESIGHT(atk, def, mult)
+#include "../../include/type_effectiveness.h"
+#undef TYPE_EFF
+#undef TYPE_EFF_FORESIGHT
+};
+
+static const u8 TypeEffectivenessForesightOverlay[NUM_TYPES][NUM_TYPES] =
+{
+#define TYPE_EFF(atk, def, mult)
+#define TYPE_EFF_FORESIGHT(atk, def, mult) [atk][def] = TYPE_EFF_ROW_##atk##_##def + 1,
+#include "../../include/type_effectiveness.h"
+#undef TYPE_EFF
+#undef TYPE_EFF_FORESIGHT
+};
+
+/**
+ *  @brief find the TypeEffectivenessTable rows that apply to a move type against both defending types.
+ *         the rows come back in table order, since the damage rounding in TypeCheckCalc depends on it
+ *
+ *  @param move_type type of the move being used
+ *  @param type1 primary type of the defender
+ *  @param type2 secondary type of the defender; skipped if it matches type1
+ *  @param foresight TRUE if foresight or scrappy lets the move ignore the entries after 0xFE
+ *  @param rows filled with up to two TypeEffectivenessTable indices from the front, -1 for unused slots
+ */
+void GetTypeEffectivenessRows(u32 move_type, u32 type1, u32 type2, BOOL foresight, int rows[2])
+{
+    u32 types[2];
+    int i, row, swap;
+
+    types[0] = type1;
+    types[1] = type2;
+    for (i = 0; i < 2; i++)
+    {
+        row = 0;
+        if (move_type < NUM_TYPES && types[i] < NUM_TYPES && (i == 0 || type1 != type2))
+        {
+            row = TypeEffectivenessMatrix[move_type][types[i]];
+            if (row == 0 && foresight == FALSE)
+            {
+                row = TypeEffectivenessForesightOverlay[move_type][types[i]];
+            }
+        }
+        rows[i] = row - 1;
+    }
+
+    if (rows[0] < 0)
+    {
+        rows[0] = rows[1];
+        rows[1] = -1;
+    }
+    else if (rows[1] >= 0 && rows[1] < rows[0])
+    {
+        swap = rows[0];
+        rows[0] = rows[1];
+        rows[1] = swap;
+    }
+}
+
 /**
  *  @brief check if a form change needs to happen.  if so, return TRUE and populate *seq_no with the subscript to run
  *
@@ -1195,44 +1140,6 @@ void ClearBattleMonFlags(struct BattleStruct *sp, int client)
     sp->log_hail_for_ice_face &= ~(1 << client); // unset log_hail_for_ice_face for client
 }
 
-/**
- *  @brief moves that soundproof blocks
- */
-u16 SoundProofMovesList[] = {
-    MOVE_BOOMBURST,
-    MOVE_BUG_BUZZ,
-    MOVE_CHATTER,
-    MOVE_CLANGING_SCALES,
-    MOVE_CLANGOROUS_SOUL,
-    MOVE_CLANGOROUS_SOULBLAZE,
-    MOVE_CONFIDE,
-    MOVE_DISARMING_VOICE,
-    MOVE_ECHOED_VOICE,
-    MOVE_EERIE_SPELL,
-    MOVE_GRASS_WHISTLE,
-    MOVE_GROWL,
-    MOVE_HEAL_BELL,
-    MOVE_HOWL,
-    MOVE_HYPER_VOICE,
-    MOVE_METAL_SOUND,
-    MOVE_NOBLE_ROAR,
-    MOVE_OVERDRIVE,
-    MOVE_PARTING_SHOT,
-    MOVE_PERISH_SONG,
-    MOVE_RELIC_SONG,
-    MOVE_ROAR,
-    MOVE_ROUND,
-    MOVE_SCREECH,
-    //MOVE_SHADOW_PANIC,
-    MOVE_SING,
-    MOVE_SNARL,
-    MOVE_SNORE,
-    MOVE_SPARKLING_ARIA,
-    MOVE_SUPERSONIC,
-    MOVE_TORCH_SONG,
-    MOVE_UPROAR
-};
-
 /**
  *  @brief get the adjusted move type accounting for normalize without relying on a client
  *
@@ -1282,16 +1189,9 @@ u32 GetAdjustedMoveTypeBasics(struct BattleStruct *sp, u32 move, u32 ability, u3
     }
     
     // so all of that happens, but we still need to handle liquid voice in a way that still lets the type != 0 happen and that the type from the move table is grabbed.  moved down here
-    if (ability == ABILITY_LIQUID_VOICE)
+    if ((ability == ABILITY_LIQUID_VOICE) && MOVE_HAS_FLAG(sp->current_move_index, MOVE_FLAG_SOUND))
     {
-        int i;
-        for (i = 0; i < (s32)NELEMS(SoundProofMovesList); i++)
-        {
-            if (SoundProofMovesList[i] == sp->current_move_index)
-                break;
-        }
-        if (i != NELEMS(SoundProofMovesList))
-            typeLocal = TYPE_WATER;
+        typeLocal = TYPE_WATER;
     }
 
     return typeLocal;
@@ -7,6 +7,7 @@
 #include "../../include/constants/ability.h"
 #include "../../include/constants/battle_script_constants.h"
 #include "../../include/constants/battle_message_constants.h"
+#include "../../include/constants/file.h"
 #include "../../include/constants/hold_item_effects.h"
 #include "../../include/constants/item.h"
 #include "../../include/constants/move_effects.h"
@@ -14,6 +15,10 @@
 #include "../../include/constants/species.h"
 #include "../../include/constants/weather_numbers.h"
 
+#ifdef DEBUG_BATTLE_SCRIPT_PROFILER
+#include "../../include/io_reg.h"
+#endif // DEBUG_BATTLE_SCRIPT_PROFILER
+
 struct EXP_CALCULATOR
 {
     /* 0x00 */ void *bw;
@@ -33,6 +38,7 @@ BOOL BattleScriptCommandHandler(void *bw, struct BattleStruct *sp);
 //int read_battle_script_param(struct BattleStruct *sp);
 //void LoadBattleSubSeqScript(struct BattleStruct *sp, int kind, int index);
 //void PushAndLoadBattleScript(struct BattleStruct *sp, int kind, int index);
+static void LoadBattleScriptFromCache(struct BattleStruct *sp, int kind, int index);
 //int GrabClientFromBattleScriptParam(void *bw, struct BattleStruct *sp, int side);
 //BOOL Link_QueueIsEmpty(struct BattleStruct *sp);
 BOOL btl_scr_cmd_0E_waitmessage(void *bw, struct BattleStruct *sp);
@@ -299,6 +305,89 @@ const u8 *BattleScrCmdNames[] =
 u32 cmdAddress = 0;
 #endif // DEBUG_BATTLE_SCRIPT_COMMANDS
 
+#ifdef DEBUG_BATTLE_SCRIPT_PROFILER
+// timer 2 counts cycles of the 33.514 MHz bus clock with no prescaler and overflows into timer 3
+#define PROFILER_TIMER_ENABLE (0x0080)
+#define PROFILER_TIMER_CASCADE (0x0004)
+
+struct BattleScriptProfile gBattleScriptProfile = {0};
+
+/**
+ *  @brief read the 32-bit cycle counter made from timers 2 and 3
+ */
+static u32 BattleScriptProfilerTime(void)
+{
+    u16 high, low;
+
+    do {
+        high = reg_OS_TM3CNT_L;
+        low = reg_OS_TM2CNT_L;
+    } while (high != reg_OS_TM3CNT_L);
+
+    return (high << 16) | low;
+}
+
+/**
+ *  @brief start the profiler if it isn't running yet and record a trace entry if a different script is about to run
+ *
+ *  @param sp global battle structure
+ */
+static void BattleScriptProfilerEnter(struct BattleStruct *sp)
+{
+    struct BattleScriptProfile *profile = &gBattleScriptProfile;
+    struct BattleScriptTraceEntry *entry;
+
+    // the battle overlay's bss is cleared when it loads, so this starts a fresh profile every battle
+    if (profile->magic != BATTLE_SCRIPT_PROFILE_MAGIC)
+    {
+        reg_OS_TM2CNT_H = 0;
+        reg_OS_TM3CNT_H = 0;
+        reg_OS_TM2CNT_L = 0;
+        reg_OS_TM3CNT_L = 0;
+        reg_OS_TM3CNT_H = PROFILER_TIMER_ENABLE | PROFILER_TIMER_CASCADE;
+        reg_OS_TM2CNT_H = PROFILER_TIMER_ENABLE;
+        profile->magic = BATTLE_SCRIPT_PROFILE_MAGIC;
+        profile->opcodes = BATTLE_SCRIPT_PROFILE_OPCODES;
+        profile->trace_entries = BATTLE_SCRIPT_TRACE_ENTRIES;
+    }
+
+    if (profile->trace_count != 0)
+    {
+        entry = &profile->trace[(profile->trace_count - 1) % BATTLE_SCRIPT_TRACE_ENTRIES];
+        if (entry->kind == sp->skill_arc_kind && entry->index == sp->skill_arc_index && entry->depth == sp->push_count)
+        {
+            return;
+        }
+    }
+
+    entry = &profile->trace[profile->trace_count % BATTLE_SCRIPT_TRACE_ENTRIES];
+    entry->cycles = (u32)profile->vm_cycles;
+    entry->kind = sp->skill_arc_kind;
+    entry->depth = sp->push_count;
+    entry->index = sp->skill_arc_index;
+    entry->pc = sp->skill_seq_no;
+    profile->trace_count++;
+}
+
+/**
+ *  @brief add a finished command to the per opcode counts
+ *
+ *  @param command opcode that ran
+ *  @param cycles cpu cycles it took
+ */
+static void BattleScriptProfilerRecord(u32 command, u32 cycles)
+{
+    struct BattleScriptProfile *profile = &gBattleScriptProfile;
+
+    profile->vm_cycles += cycles;
+    if (command < BATTLE_SCRIPT_PROFILE_OPCODES)
+    {
+        profile->count[command]++;
+        profile->cycles[command] += cycles;
+    }
+}
+#endif // DEBUG_BATTLE_SCRIPT_PROFILER
+
 
 const btl_scr_cmd_func NewBattleScriptCmdTable[] =
 {
@@ -518,6 +607,9 @@ BOOL BattleScriptCommandHandler(void *bw, struct BattleStruct *sp)
 #ifdef DEBUG_BATTLE_SCRIPT_COMMANDS
     u8 buf[64];
 #endif //DEBUG_BATTLE_SCRIPT_COMMANDS
+#ifdef DEBUG_BATTLE_SCRIPT_PROFILER
+    u32 start;
+#endif // DEBUG_BATTLE_SCRIPT_PROFILER
 
     do {
         command = sp->SkillSeqWork[sp->skill_seq_no];
@@ -549,7 +641,17 @@ BOOL BattleScriptCommandHandler(void *bw, struct BattleStruct *sp)
         }
 #endif //DEBUG_BATTLE_SCRIPT_COMMANDS
 
-        if (command < START_OF_NEW_BTL_SCR_CMDS)
+#ifdef DEBUG_BATTLE_SCRIPT_PROFILER
+        BattleScriptProfilerEnter(sp);
+        start = BattleScriptProfilerTime();
+#endif // DEBUG_BATTLE_SCRIPT_PROFILER
+
+        if (command == 0xE0 && sp->push_count) // endscript returning to a pushed script, reload it through the cache
+        {
+            PopBattleScript(sp);
+            ret = FALSE;
+        }
+        else if (command < START_OF_NEW_BTL_SCR_CMDS)
         {
             ret = BattleScriptCmdTable[command](bw, sp);
         }
@@ -557,6 +659,10 @@ BOOL BattleScriptCommandHandler(void *bw, struct BattleStruct *sp)
         {
             ret = NewBattleScriptCmdTable[command - START_OF_NEW_BTL_SCR_CMDS](bw, sp);
         }
+
+#ifdef DEBUG_BATTLE_SCRIPT_PROFILER
+        BattleScriptProfilerRecord(command, BattleScriptProfilerTime() - start);
+#endif // DEBUG_BATTLE_SCRIPT_PROFILER
     } while ((sp->battle_progress_flag == 0) && ((BattleTypeGet(bw) & BATTLE_TYPE_WIRELESS) == 0));
 
     sp->battle_progress_flag = 0;
@@ -592,7 +698,7 @@ void LoadBattleSubSeqScript(struct BattleStruct *sp, int kind, int index)
     sp->skill_arc_kind = kind;
     sp->skill_arc_index = index;
     sp->skill_seq_no = 0;
-    ArchiveDataLoad(&sp->SkillSeqWork, kind, index);
+    LoadBattleScriptFromCache(sp, kind, index);
 }
 
 /**
@@ -611,7 +717,125 @@ void PushAndLoadBattleScript(struct BattleStruct *sp, int kind, int index)
     sp->skill_arc_kind = kind;
     sp->skill_arc_index = index;
     sp->skill_seq_no = 0;
-    ArchiveDataLoad(&sp->SkillSeqWork, kind, index);
+    LoadBattleScriptFromCache(sp, kind, index);
+}
+
+/**
+ *  @brief return from a subscript loaded by PushAndLoadBattleScript, reloading the script that pushed it
+ *
+ *  @param sp global battle structure
+ *  @return TRUE if there was a script to return to, FALSE if the script stack is empty
+ */
+BOOL PopBattleScript(struct BattleStruct *sp)
+{
+    if (sp->push_count == 0)
+    {
+        return FALSE;
+    }
+
+    sp->push_count--;
+    sp->skill_arc_kind = sp->push_skill_arc_kind[sp->push_count];
+    sp->skill_arc_index = sp->push_skill_arc_index[sp->push_count];
+    sp->skill_seq_no = sp->push_skill_seq_no[sp->push_count];
+    LoadBattleScriptFromCache(sp, sp->skill_arc_kind, sp->skill_arc_index);
+    return TRUE;
+}
+
+// subscripts that run nearly every turn, loaded into the cache when the battle starts
+static const u16 sHotBattleSubScripts[] =
+{
+    SUB_SEQ_TRY_MOVE,
+    SUB_SEQ_HP_CHANGE,
+    SUB_SEQ_CRITICAL_HIT,
+    SUB_SEQ_BOOST_STATS,
+    SUB_SEQ_FAINT,
+};
+
+/**
+ *  @brief copy a battle script to SkillSeqWork, reading it from the file system only if it isn't already cached.
+ *         a miss for a script that fits in a slot replaces the least recently used one
+ *
+ *  @param sp global battle structure
+ *  @param kind ARC_* constant to load from
+ *  @param index number to load
+ */
+static void LoadBattleScriptFromCache(struct BattleStruct *sp, int kind, int index)
+{
+    struct BattleScriptCache *cache = &sp->scriptCache;
+    struct BattleScriptCacheSlot *slot, *oldest = &cache->slot[0];
+    int i, words;
+#ifdef DEBUG_BATTLE_SCRIPT_CACHE
+    u8 buf[128];
+#endif // DEBUG_BATTLE_SCRIPT_CACHE
+
+    cache->clock++;
+    for (i = 0; i < BATTLE_SCRIPT_CACHE_SLOTS; i++)
+    {
+        slot = &cache->slot[i];
+        if (slot->last_use != 0 && slot->kind == kind && slot->index == index)
+        {
+            // past the end of the script, SkillSeqWork is left the way a fresh load below leaves it
+            memcpy(sp->SkillSeqWork, slot->script, slot->words * sizeof(int));
+            memset(&sp->SkillSeqWork[slot->words], 0, (BATTLE_SCRIPT_MAX_WORDS - slot->words) * sizeof(int));
+            slot->last_use = cache->clock;
+            cache->hits++;
+            return;
+        }
+        if (slot->last_use < oldest->last_use)
+        {
+            oldest = slot;
+        }
+    }
+
+    // the file system only writes as much as the file holds, so clear the rest of SkillSeqWork first
+    memset(sp->SkillSeqWork, 0, sizeof(sp->SkillSeqWork));
+    ArchiveDataLoad(sp->SkillSeqWork, kind, index);
+    for (words = BATTLE_SCRIPT_MAX_WORDS; words > 0 && sp->SkillSeqWork[words - 1] == 0; words--) {}
+    cache->misses++;
+    cache->bytes_read += words * sizeof(int);
+
+    if (words <= BATTLE_SCRIPT_CACHE_SLOT_WORDS)
+    {
+        slot = oldest;
+        memcpy(slot->script, sp->SkillSeqWork, words * sizeof(int));
+        slot->kind = kind;
+        slot->index = index;
+        slot->words = words;
+        slot->last_use = cache->clock;
+    }
+    else
+    {
+        cache->oversized++;
+    }
+
+#ifdef DEBUG_BATTLE_SCRIPT_CACHE
+    sprintf(buf, "[BattleScriptCache] miss %d/%d: %d hits, %d misses (%d too long to cache), %d bytes read\n", kind, index, cache->hits, cache->misses, cache->oversized, cache->bytes_read);
+    debugsyscall(buf);
+#endif // DEBUG_BATTLE_SCRIPT_CACHE
+}
+
+/**
+ *  @brief load the battle scripts that run nearly every turn into the battle script cache
+ *
+ *  @param sp global battle structure
+ */
+void WarmBattleScriptCache(struct BattleStruct *sp)
+{
+    u32 i;
+#ifdef DEBUG_BATTLE_SCRIPT_CACHE
+    u8 buf[160];
+
+    // the BattleStruct has just been allocated, so this is what the rest of the battle has to work with
+    sprintf(buf, "[BattleScriptCache] BattleStruct is 0x%X bytes, 0x%X of them the cache and 0x%X the ai score matrices.  0x%X bytes left in heap 5\n", sizeof(struct BattleStruct), sizeof(struct BattleScriptCache), sizeof(sp->aiScoreMatrix), GF_ExpHeap_FndGetTotalFreeSize(5));
+    debugsyscall(buf);
+#endif // DEBUG_BATTLE_SCRIPT_CACHE
+
+    // the scripts are read through SkillSeqWork, which has to be empty again before the battle starts
+    for (i = 0; i < NELEMS(sHotBattleSubScripts); i++)
+    {
+        LoadBattleScriptFromCache(sp, ARC_BATTLE_SUB_SEQ, sHotBattleSubScripts[i]);
+    }
+    memset(sp->SkillSeqWork, 0, sizeof(sp->SkillSeqWork));
 }
 
 /**
@@ -30,6 +30,7 @@ struct BattleStruct *ServerInit(void *bw)
     sp = sys_AllocMemory(5, sizeof(struct BattleStruct));
     memset(sp, 0, sizeof(struct BattleStruct));
     BattleStructureInit(sp);
+    WarmBattleScriptCache(sp);
     BattleStructureCounterInit(bw, sp);
     ServerMoveAIInit(bw, sp);
     DumpMoveTableData(&sp->moveTbl[0]);
@@ -76,6 +77,7 @@ void ServerBeforeAct(void *bw, struct BattleStruct *sp)
             {
                 sp->oneSelfFlag[client_no].defiant_flag = 0;
             }
+            AIClearScoreMatrices(sp); // everyone has picked their move, the next ai decision is about a different battle
             sp->sba_work = 0;
             sp->sba_seq_no++;
             break;
@@ -271,6 +271,69 @@ const struct MegaStructMove sMegaMoveTable[] =
         .form = 1,
     },
 };
+
+// per species chains through sMegaTable and sMegaMoveTable, built the first time a mega lookup runs.
+// sMegaFirst[species] is the first row for that species + 1, sMegaNext[row] the next row for the same species + 1,
+// 0 ending the chain.  rows stay in table order, so the first match is the same one the old table scans found
+static u8 sMegaFirst[MAX_MON_NUM + 1];
+static u8 sMegaNext[NELEMS(sMegaTable)];
+static u8 sMegaMoveFirst[MAX_MON_NUM + 1];
+static u8 sMegaMoveNext[NELEMS(sMegaMoveTable)];
+static BOOL sMegaIndexBuilt;
+
+// the links are stored as row + 1 in a u8, with 0 ending the chain
+_Static_assert(NELEMS(sMegaTable) <= 0xFF, "sMegaTable has too many rows for the u8 chain links");
+_Static_assert(NELEMS(sMegaMoveTable) <= 0xFF, "sMegaMoveTable has too many rows for the u8 chain links");
+
+/**
+ *  @brief build the species -> sMegaTable/sMegaMoveTable row chains if they aren't already
+ */
+static void BuildMegaIndex(void)
+{
+    u32 i;
+
+    if (sMegaIndexBuilt)
+        return;
+
+    for (i = NELEMS(sMegaTable); i > 0; i--)
+    {
+        GF_ASSERT(sMegaTable[i - 1].monindex <= MAX_MON_NUM);
+        sMegaNext[i - 1] = sMegaFirst[sMegaTable[i - 1].monindex];
+        sMegaFirst[sMegaTable[i - 1].monindex] = i;
+    }
+    for (i = NELEMS(sMegaMoveTable); i > 0; i--)
+    {
+        GF_ASSERT(sMegaMoveTable[i - 1].monindex <= MAX_MON_NUM);
+        sMegaMoveNext[i - 1] = sMegaMoveFirst[sMegaMoveTable[i - 1].monindex];
+        sMegaMoveFirst[sMegaMoveTable[i - 1].monindex] = i;
+    }
+
+    sMegaIndexBuilt = TRUE;
+}
+
+/**
+ *  @brief get the first sMegaTable row for a species
+ *
+ *  @param mon species
+ *  @return row + 1, 0 if the species has none.  continue with sMegaNext[row]
+ */
+static u32 GetFirstMegaRow(u32 mon)
+{
+    BuildMegaIndex();
+    return (mon <= MAX_MON_NUM) ? sMegaFirst[mon] : 0;
+}
+
+/**
+ *  @brief get the first sMegaMoveTable row for a species
+ *
+ *  @param mon species
+ *  @return row + 1, 0 if the species has none.  continue with sMegaMoveNext[row]
+ */
+static u32 GetFirstMegaMoveRow(u32 mon)
+{
+    BuildMegaIndex();
+    return (mon <= MAX_MON_NUM) ? sMegaMoveFirst[mon] : 0;
+}
 #endif // MEGA_EVOLUTIONS
 
 static BOOL CheckMegaData(u32 mon, u32 item);
@@ -281,6 +344,7 @@ BOOL CheckCanMega(struct BattleStruct *battle, int client)
     u16 mon = battle->battlemon[client].species;
     u16 item = battle->battlemon[client].item;
     u32 form = battle->battlemon[client].form_no;
+    u16 moves[4];
 
     if (battle->battlemon[client].canMega)
         return FALSE;
@@ -294,16 +358,20 @@ BOOL CheckCanMega(struct BattleStruct *battle, int client)
     if (battle->client_act_work[client][3] != SELECT_FIGHT_COMMAND)
         return FALSE;
 
-    return (CheckMegaData(mon, item) || CheckMegaMoveData(mon, battle->battlemon[client].move));
+    // BattlePokemon is packed, so its moves are copied out instead of handed over as a u16 *
+    for (int i = 0; i < 4; i++)
+        moves[i] = battle->battlemon[client].move[i];
+
+    return (CheckMegaData(mon, item) || CheckMegaMoveData(mon, moves));
 }
 
 BOOL IsMegaSpecies(u32 mon, u32 form)
 {
 #ifdef MEGA_EVOLUTIONS
-    u32 i;
-    for (i = 0; i < NELEMS(sMegaTable); i++)
+    u32 row;
+    for (row = GetFirstMegaRow(mon); row != 0; row = sMegaNext[row - 1])
     {
-        if (sMegaTable[i].monindex == mon && sMegaTable[i].form == form)
+        if (sMegaTable[row - 1].form == form)
         {
             return TRUE;
         }
@@ -383,10 +451,10 @@ BOOL CheckIsPrimalKyogre(struct BI_PARAM *bip)
 static BOOL CheckMegaData(u32 mon, u32 item)
 {
 #ifdef MEGA_EVOLUTIONS
-    u32 i;
-    for (i = 0; i < NELEMS(sMegaTable); i++)
+    u32 row;
+    for (row = GetFirstMegaRow(mon); row != 0; row = sMegaNext[row - 1])
     {
-        if (sMegaTable[i].monindex == mon && sMegaTable[i].itemindex == item)
+        if (sMegaTable[row - 1].itemindex == item)
         {
             return TRUE;
         }
@@ -398,20 +466,18 @@ static BOOL CheckMegaData(u32 mon, u32 item)
 u32 GrabMegaTargetForm(u32 mon, u32 item)
 {
 #ifdef MEGA_EVOLUTIONS
-    u32 i;
-    for (i = 0; i < NELEMS(sMegaTable);i++)
+    u32 row;
+    for (row = GetFirstMegaRow(mon); row != 0; row = sMegaNext[row - 1])
     {
-        if (sMegaTable[i].monindex == mon && sMegaTable[i].itemindex == item)
+        if (sMegaTable[row - 1].itemindex == item)
         {
-            return sMegaTable[i].form;
+            return sMegaTable[row - 1].form;
         }
     }
-    for (i = 0; i < (s32)NELEMS(sMegaMoveTable); i++)
+    row = GetFirstMegaMoveRow(mon);
+    if (row != 0)
     {
-        if (sMegaMoveTable[i].monindex == mon)
-        {
-            return sMegaMoveTable[i].form;
-        }
+        return sMegaMoveTable[row - 1].form;
     }
 #endif // MEGA_EVOLUTIONS
     return 0;
@@ -420,16 +486,14 @@ u32 GrabMegaTargetForm(u32 mon, u32 item)
 static BOOL CheckMegaMoveData(u32 mon, u16 *moves)
 {
 #ifdef MEGA_EVOLUTIONS
-    int i, j;
-    for (i = 0; i < (s32)NELEMS(sMegaMoveTable); i++)
+    u32 row;
+    int j;
+    for (row = GetFirstMegaMoveRow(mon); row != 0; row = sMegaMoveNext[row - 1])
     {
-        if (sMegaMoveTable[i].monindex == mon)
+        for (j = 0; j < 4; j++)
         {
-            for (j = 0; j < 4; j++)
-            {
-                if (sMegaMoveTable[i].moveindex == moves[j])
-                    return TRUE;
-            }
+            if (sMegaMoveTable[row - 1].moveindex == moves[j])
+                return TRUE;
         }
     }
 #endif // MEGA_EVOLUTIONS
@@ -469,36 +533,22 @@ BOOL CheckCanDrawMegaButton(struct BI_PARAM *bip)
 
 BOOL CheckCanSpeciesMegaEvolveByMove(struct BattleStruct *sp, u32 client)
 {
-#ifdef MEGA_EVOLUTIONS
-    int i, j, species;
-    
-    species = sp->battlemon[client].species;
-    //move = ST_ServerSelectWazaGet(sp, client);
-    
-    for (i = 0; i < (s32)NELEMS(sMegaMoveTable); i++)
-    {
-        if (species == sMegaMoveTable[i].monindex)
-        {
-            for (j = 0; j < 4; j++)
-            {
-                if (sp->battlemon[client].move[j] == sMegaMoveTable[i].moveindex)
-                    return TRUE;
-            }
-        }
-    }
-#endif // MEGA_EVOLUTIONS
-    
-    return FALSE;
+    u16 moves[4];
+
+    for (int i = 0; i < 4; i++)
+        moves[i] = sp->battlemon[client].move[i];
+
+    return CheckMegaMoveData(sp->battlemon[client].species, moves);
 }
 
 BOOL IsMegaSpeciesByMove(u32 species, u32 form)
 {
 #ifdef MEGA_EVOLUTIONS
-    int i;
+    u32 row;
     
-    for (i = 0; i < (s32)NELEMS(sMegaMoveTable); i++)
+    for (row = GetFirstMegaMoveRow(species); row != 0; row = sMegaMoveNext[row - 1])
     {
-        if (species == sMegaMoveTable[i].monindex && form == sMegaMoveTable[i].form)
+        if (sMegaMoveTable[row - 1].form == form)
         {
             return TRUE;
         }
@@ -0,0 +1,165 @@
+#include "../../include/types.h"
+#include "../../include/battle.h"
+#include "../../include/constants/moves.h"
+
+/**
+ *  @brief MOVE_FLAG_* properties of every move, indexed by move number.
+ *         one line per move with all of its flags; a move listed twice trips -Woverride-init
+ */
+const u16 gMoveFlags[NUM_OF_MOVES] =
+{
+    [MOVE_COMET_PUNCH]          = MOVE_FLAG_IRON_FIST,
+    [MOVE_MEGA_PUNCH]           = MOVE_FLAG_IRON_FIST,
+    [MOVE_FIRE_PUNCH]           = MOVE_FLAG_IRON_FIST,
+    [MOVE_ICE_PUNCH]            = MOVE_FLAG_IRON_FIST,
+    [MOVE_THUNDER_PUNCH]        = MOVE_FLAG_IRON_FIST,
+    [MOVE_CUT]                  = MOVE_FLAG_SHARPNESS,
+    [MOVE_BITE]                 = MOVE_FLAG_STRONG_JAW,
+    [MOVE_GROWL]                = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_ROAR]                 = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_SING]                 = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_SUPERSONIC]           = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_ABSORB]               = MOVE_FLAG_TRIAGE,
+    [MOVE_MEGA_DRAIN]           = MOVE_FLAG_TRIAGE,
+    [MOVE_RAZOR_LEAF]           = MOVE_FLAG_SHARPNESS,
+    [MOVE_POISON_POWDER]        = MOVE_FLAG_POWDER,
+    [MOVE_STUN_SPORE]           = MOVE_FLAG_POWDER,
+    [MOVE_SLEEP_POWDER]         = MOVE_FLAG_POWDER,
+    [MOVE_SCREECH]              = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_RECOVER]              = MOVE_FLAG_TRIAGE,
+    [MOVE_EGG_BOMB]             = MOVE_FLAG_BULLETPROOF,
+    [MOVE_SOFT_BOILED]          = MOVE_FLAG_TRIAGE,
+    [MOVE_DREAM_EATER]          = MOVE_FLAG_TRIAGE,
+    [MOVE_BARRAGE]              = MOVE_FLAG_BULLETPROOF,
+    [MOVE_LEECH_LIFE]           = MOVE_FLAG_TRIAGE,
+    [MOVE_DIZZY_PUNCH]          = MOVE_FLAG_IRON_FIST,
+    [MOVE_SPORE]                = MOVE_FLAG_POWDER,
+    [MOVE_REST]                 = MOVE_FLAG_TRIAGE,
+    [MOVE_HYPER_FANG]           = MOVE_FLAG_STRONG_JAW,
+    [MOVE_SLASH]                = MOVE_FLAG_SHARPNESS,
+    [MOVE_SNORE]                = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_COTTON_SPORE]         = MOVE_FLAG_POWDER,
+    [MOVE_MACH_PUNCH]           = MOVE_FLAG_IRON_FIST,
+    [MOVE_SLUDGE_BOMB]          = MOVE_FLAG_BULLETPROOF,
+    [MOVE_OCTAZOOKA]            = MOVE_FLAG_BULLETPROOF,
+    [MOVE_ZAP_CANNON]           = MOVE_FLAG_BULLETPROOF,
+    [MOVE_PERISH_SONG]          = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_GIGA_DRAIN]           = MOVE_FLAG_TRIAGE,
+    [MOVE_MILK_DRINK]           = MOVE_FLAG_TRIAGE,
+    [MOVE_FURY_CUTTER]          = MOVE_FLAG_SHARPNESS,
+    [MOVE_HEAL_BELL]            = MOVE_FLAG_SOUND,
+    [MOVE_DYNAMIC_PUNCH]        = MOVE_FLAG_IRON_FIST,
+    [MOVE_MORNING_SUN]          = MOVE_FLAG_TRIAGE,
+    [MOVE_SYNTHESIS]            = MOVE_FLAG_TRIAGE,
+    [MOVE_MOONLIGHT]            = MOVE_FLAG_TRIAGE,
+    [MOVE_CRUNCH]               = MOVE_FLAG_STRONG_JAW,
+    [MOVE_SHADOW_BALL]          = MOVE_FLAG_BULLETPROOF,
+    [MOVE_UPROAR]               = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_SWALLOW]              = MOVE_FLAG_TRIAGE,
+    [MOVE_FOCUS_PUNCH]          = MOVE_FLAG_IRON_FIST,
+    [MOVE_WISH]                 = MOVE_FLAG_TRIAGE,
+    [MOVE_MIST_BALL]            = MOVE_FLAG_BULLETPROOF,
+    [MOVE_ICE_BALL]             = MOVE_FLAG_BULLETPROOF,
+    [MOVE_SLACK_OFF]            = MOVE_FLAG_TRIAGE,
+    [MOVE_HYPER_VOICE]          = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_POISON_FANG]          = MOVE_FLAG_STRONG_JAW,
+    [MOVE_METEOR_MASH]          = MOVE_FLAG_IRON_FIST,
+    [MOVE_WEATHER_BALL]         = MOVE_FLAG_BULLETPROOF,
+    [MOVE_AIR_CUTTER]           = MOVE_FLAG_SHARPNESS,
+    [MOVE_METAL_SOUND]          = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_GRASS_WHISTLE]        = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_SHADOW_PUNCH]         = MOVE_FLAG_IRON_FIST,
+    [MOVE_SKY_UPPERCUT]         = MOVE_FLAG_IRON_FIST,
+    [MOVE_BULLET_SEED]          = MOVE_FLAG_BULLETPROOF,
+    [MOVE_AERIAL_ACE]           = MOVE_FLAG_SHARPNESS,
+    [MOVE_HOWL]                 = MOVE_FLAG_SOUND,
+    [MOVE_LEAF_BLADE]           = MOVE_FLAG_SHARPNESS,
+    [MOVE_ROCK_BLAST]           = MOVE_FLAG_BULLETPROOF,
+    [MOVE_WATER_PULSE]          = MOVE_FLAG_MEGA_LAUNCHER,
+    [MOVE_ROOST]                = MOVE_FLAG_TRIAGE,
+    [MOVE_HAMMER_ARM]           = MOVE_FLAG_IRON_FIST,
+    [MOVE_GYRO_BALL]            = MOVE_FLAG_BULLETPROOF,
+    [MOVE_HEALING_WISH]         = MOVE_FLAG_TRIAGE,
+    [MOVE_AURA_SPHERE]          = MOVE_FLAG_MEGA_LAUNCHER | MOVE_FLAG_BULLETPROOF,
+    [MOVE_DARK_PULSE]           = MOVE_FLAG_MEGA_LAUNCHER,
+    [MOVE_NIGHT_SLASH]          = MOVE_FLAG_SHARPNESS,
+    [MOVE_SEED_BOMB]            = MOVE_FLAG_BULLETPROOF,
+    [MOVE_AIR_SLASH]            = MOVE_FLAG_SHARPNESS,
+    [MOVE_X_SCISSOR]            = MOVE_FLAG_SHARPNESS,
+    [MOVE_BUG_BUZZ]             = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_DRAGON_PULSE]         = MOVE_FLAG_MEGA_LAUNCHER,
+    [MOVE_DRAIN_PUNCH]          = MOVE_FLAG_IRON_FIST | MOVE_FLAG_TRIAGE,
+    [MOVE_FOCUS_BLAST]          = MOVE_FLAG_BULLETPROOF,
+    [MOVE_ENERGY_BALL]          = MOVE_FLAG_BULLETPROOF,
+    [MOVE_BULLET_PUNCH]         = MOVE_FLAG_IRON_FIST,
+    [MOVE_THUNDER_FANG]         = MOVE_FLAG_STRONG_JAW,
+    [MOVE_ICE_FANG]             = MOVE_FLAG_STRONG_JAW,
+    [MOVE_FIRE_FANG]            = MOVE_FLAG_STRONG_JAW,
+    [MOVE_MUD_BOMB]             = MOVE_FLAG_BULLETPROOF,
+    [MOVE_PSYCHO_CUT]           = MOVE_FLAG_SHARPNESS,
+    [MOVE_ROCK_WRECKER]         = MOVE_FLAG_BULLETPROOF,
+    [MOVE_CROSS_POISON]         = MOVE_FLAG_SHARPNESS,
+    [MOVE_MAGNET_BOMB]          = MOVE_FLAG_BULLETPROOF,
+    [MOVE_CHATTER]              = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_HEAL_ORDER]           = MOVE_FLAG_TRIAGE,
+    [MOVE_LUNAR_DANCE]          = MOVE_FLAG_TRIAGE,
+    [MOVE_RAGE_POWDER]          = MOVE_FLAG_POWDER,
+    [MOVE_ELECTRO_BALL]         = MOVE_FLAG_BULLETPROOF,
+    [MOVE_ACID_SPRAY]           = MOVE_FLAG_BULLETPROOF,
+    [MOVE_ROUND]                = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_ECHOED_VOICE]         = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_HEAL_PULSE]           = MOVE_FLAG_MEGA_LAUNCHER | MOVE_FLAG_TRIAGE,
+    [MOVE_HORN_LEECH]           = MOVE_FLAG_TRIAGE,
+    [MOVE_SACRED_SWORD]         = MOVE_FLAG_SHARPNESS,
+    [MOVE_RAZOR_SHELL]          = MOVE_FLAG_SHARPNESS,
+    [MOVE_SEARING_SHOT]         = MOVE_FLAG_BULLETPROOF,
+    [MOVE_RELIC_SONG]           = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_SECRET_SWORD]         = MOVE_FLAG_SHARPNESS,
+    [MOVE_SNARL]                = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_NOBLE_ROAR]           = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_PARABOLIC_CHARGE]     = MOVE_FLAG_TRIAGE,
+    [MOVE_DISARMING_VOICE]      = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_PARTING_SHOT]         = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_DRAINING_KISS]        = MOVE_FLAG_TRIAGE,
+    [MOVE_BOOMBURST]            = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_CONFIDE]              = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_POWDER]               = MOVE_FLAG_POWDER,
+    [MOVE_POWER_UP_PUNCH]       = MOVE_FLAG_IRON_FIST,
+    [MOVE_OBLIVION_WING]        = MOVE_FLAG_TRIAGE,
+    [MOVE_ORIGIN_PULSE]         = MOVE_FLAG_MEGA_LAUNCHER,
+    [MOVE_SHORE_UP]             = MOVE_FLAG_TRIAGE,
+    [MOVE_SPARKLING_ARIA]       = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_ICE_HAMMER]           = MOVE_FLAG_IRON_FIST,
+    [MOVE_FLORAL_HEALING]       = MOVE_FLAG_TRIAGE,
+    [MOVE_STRENGTH_SAP]         = MOVE_FLAG_TRIAGE,
+    [MOVE_SOLAR_BLADE]          = MOVE_FLAG_SHARPNESS,
+    [MOVE_POLLEN_PUFF]          = MOVE_FLAG_BULLETPROOF,
+    [MOVE_PURIFY]               = MOVE_FLAG_TRIAGE,
+    [MOVE_CLANGING_SCALES]      = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_PSYCHIC_FANGS]        = MOVE_FLAG_STRONG_JAW,
+    [MOVE_PLASMA_FISTS]         = MOVE_FLAG_IRON_FIST,
+    [MOVE_CLANGOROUS_SOULBLAZE] = MOVE_FLAG_SOUND,
+    [MOVE_DOUBLE_IRON_BASH]     = MOVE_FLAG_IRON_FIST,
+    [MOVE_JAW_LOCK]             = MOVE_FLAG_STRONG_JAW,
+    [MOVE_MAGIC_POWDER]         = MOVE_FLAG_POWDER,
+    [MOVE_FISHIOUS_REND]        = MOVE_FLAG_STRONG_JAW,
+    [MOVE_CLANGOROUS_SOUL]      = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_PYRO_BALL]            = MOVE_FLAG_BULLETPROOF,
+    [MOVE_BEHEMOTH_BLADE]       = MOVE_FLAG_SHARPNESS,
+    [MOVE_OVERDRIVE]            = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_TERRAIN_PULSE]        = MOVE_FLAG_MEGA_LAUNCHER,
+    [MOVE_WICKED_BLOW]          = MOVE_FLAG_IRON_FIST,
+    [MOVE_SURGING_STRIKES]      = MOVE_FLAG_IRON_FIST,
+    [MOVE_EERIE_SPELL]          = MOVE_FLAG_SOUND | MOVE_FLAG_SOUNDPROOF,
+    [MOVE_STONE_AXE]            = MOVE_FLAG_SHARPNESS,
+    [MOVE_HEADLONG_RUSH]        = MOVE_FLAG_IRON_FIST,
+    [MOVE_CEASELESS_EDGE]       = MOVE_FLAG_SHARPNESS,
+    [MOVE_JET_PUNCH]            = MOVE_FLAG_IRON_FIST,
+    [MOVE_POPULATION_BOMB]      = MOVE_FLAG_SHARPNESS,
+    [MOVE_KOWTOW_CLEAVE]        = MOVE_FLAG_SHARPNESS,
+    [MOVE_TORCH_SONG]           = MOVE_FLAG_SOUND,
+    [MOVE_RAGE_FIST]            = MOVE_FLAG_IRON_FIST,
+    [MOVE_BITTER_BLADE]         = MOVE_FLAG_SHARPNESS,
+    [MOVE_AQUA_CUTTER]          = MOVE_FLAG_SHARPNESS,
+    [MOVE_PSYBLADE]             = MOVE_FLAG_SHARPNESS,
+};
@@ -38,51 +38,6 @@ const AccuracyStatChangeRatio sAccStatChanges[] =
     {   3,   1 },
 };
 
-const u16 PowderMovesList[] = {
-    MOVE_COTTON_SPORE,
-    MOVE_POISON_POWDER,
-    MOVE_SLEEP_POWDER,
-    MOVE_STUN_SPORE,
-    MOVE_SPORE,
-    MOVE_POWDER,
-    MOVE_RAGE_POWDER,
-    MOVE_MAGIC_POWDER,
-};
-
-// Moves that Triage boosts the priority of.
-// Move effects might be a tidier way to do it, but we don't have those defined for some of these moves yet.
-const u16 TriageMovesList[] = {
-    MOVE_ABSORB,
-    MOVE_DRAIN_PUNCH,
-    MOVE_DRAINING_KISS,
-    MOVE_DREAM_EATER,
-    MOVE_FLORAL_HEALING,
-    MOVE_GIGA_DRAIN,
-    MOVE_HEAL_ORDER,
-    MOVE_HEAL_PULSE,
-    MOVE_HEALING_WISH,
-    MOVE_HORN_LEECH,
-    MOVE_LEECH_LIFE,
-    MOVE_LUNAR_DANCE,
-    MOVE_MEGA_DRAIN,
-    MOVE_MILK_DRINK,
-    MOVE_MOONLIGHT,
-    MOVE_MORNING_SUN,
-    MOVE_OBLIVION_WING,
-    MOVE_PARABOLIC_CHARGE,
-    MOVE_PURIFY,
-    MOVE_RECOVER,
-    MOVE_REST,
-    MOVE_ROOST,
-    MOVE_SHORE_UP,
-    MOVE_SLACK_OFF,
-    MOVE_SOFT_BOILED,
-    MOVE_STRENGTH_SAP,
-    MOVE_SWALLOW,
-    MOVE_SYNTHESIS,
-    MOVE_WISH,
-};
-
 // set sp->waza_status_flag |= MOVE_STATUS_FLAG_MISS if a miss
 BOOL CalcAccuracy(void *bw, struct BattleStruct *sp, int attacker, int defender, int move_no)
 {
@@ -117,19 +72,16 @@ BOOL CalcAccuracy(void *bw, struct BattleStruct *sp, int attacker, int defender,
         return FALSE;
     }
 
-    int i;
-
-    for (i = 0; i < (s32)NELEMS(PowderMovesList); i++) {
-        if (sp->current_move_index == PowderMovesList[i]) {
-            if
-            (
-                (BattlePokemonParamGet(sp, sp->defence_client, BATTLE_MON_DATA_TYPE1, NULL) == TYPE_GRASS) ||
-                (BattlePokemonParamGet(sp, sp->defence_client, BATTLE_MON_DATA_TYPE2, NULL) == TYPE_GRASS)
-            )
-            {
-                sp->waza_status_flag |= MOVE_STATUS_FLAG_NOT_EFFECTIVE;
-                return FALSE;
-            }
+    if (MOVE_HAS_FLAG(sp->current_move_index, MOVE_FLAG_POWDER))
+    {
+        if
+        (
+            (BattlePokemonParamGet(sp, sp->defence_client, BATTLE_MON_DATA_TYPE1, NULL) == TYPE_GRASS) ||
+            (BattlePokemonParamGet(sp, sp->defence_client, BATTLE_MON_DATA_TYPE2, NULL) == TYPE_GRASS)
+        )
+        {
+            sp->waza_status_flag |= MOVE_STATUS_FLAG_NOT_EFFECTIVE;
+            return FALSE;
         }
     }
 
@@ -340,6 +292,8 @@ u8 CalcSpeed(void *bw, struct BattleStruct *sp, int client1, int client2, int fl
     int stat_stage_spd1;
     int stat_stage_spd2;
     u32 i;
+    struct BattlerCalcSnapshot mon1;
+    struct BattlerCalcSnapshot mon2;
 
     // if one mon is fainted and the other isn't, then the alive one obviously goes first
     if ((sp->battlemon[client1].hp == 0) && (sp->battlemon[client2].hp))
@@ -351,18 +305,21 @@ u8 CalcSpeed(void *bw, struct BattleStruct *sp, int client1, int client2, int fl
         return 0;
     }
 
-    ability1 = GetBattlerAbility(sp, client1);
-    ability2 = GetBattlerAbility(sp, client2);
+    FillBattlerCalcSnapshot(sp, client1, &mon1);
+    FillBattlerCalcSnapshot(sp, client2, &mon2);
+
+    ability1 = mon1.ability;
+    ability2 = mon2.ability;
 
-    hold_effect1 = HeldItemHoldEffectGet(sp, client1);
-    hold_atk1 = HeldItemAtkGet(sp, client1, 0);
-    hold_effect2 = HeldItemHoldEffectGet(sp, client2);
-    hold_atk2 = HeldItemAtkGet(sp, client2, 0);
+    hold_effect1 = mon1.item_held_effect;
+    hold_atk1 = mon1.item_power;
+    hold_effect2 = mon2.item_held_effect;
+    hold_atk2 = mon2.item_power;
 
-    stat_stage_spd1 = sp->battlemon[client1].states[STAT_SPEED];
-    stat_stage_spd2 = sp->battlemon[client2].states[STAT_SPEED];
+    stat_stage_spd1 = mon1.states[STAT_SPEED];
+    stat_stage_spd2 = mon2.states[STAT_SPEED];
 
-    if (GetBattlerAbility(sp, client1) == ABILITY_SIMPLE)
+    if (ability1 == ABILITY_SIMPLE)
     {
         stat_stage_spd1 = 6 + ((stat_stage_spd1 - 6) * 2);
         if (stat_stage_spd1 > 12)
@@ -374,7 +331,7 @@ u8 CalcSpeed(void *bw, struct BattleStruct *sp, int client1, int client2, int fl
             stat_stage_spd1 = 0;
         }
     }
-    if (GetBattlerAbility(sp, client2) == ABILITY_SIMPLE)
+    if (ability2 == ABILITY_SIMPLE)
     {
         stat_stage_spd2 = 6 + ((stat_stage_spd2 - 6) * 2);
         if (stat_stage_spd2 > 12)
@@ -387,8 +344,8 @@ u8 CalcSpeed(void *bw, struct BattleStruct *sp, int client1, int client2, int fl
         }
     }
 
-    speed1 = sp->battlemon[client1].speed * StatBoostModifiers[stat_stage_spd1][0] / StatBoostModifiers[stat_stage_spd1][1];
-    speed2 = sp->battlemon[client2].speed * StatBoostModifiers[stat_stage_spd2][0] / StatBoostModifiers[stat_stage_spd2][1];
+    speed1 = mon1.speed * StatBoostModifiers[stat_stage_spd1][0] / StatBoostModifiers[stat_stage_spd1][1];
+    speed2 = mon2.speed * StatBoostModifiers[stat_stage_spd2][0] / StatBoostModifiers[stat_stage_spd2][1];
 
     if ((CheckSideAbility(bw, sp, CHECK_ALL_BATTLER_ALIVE, 0, ABILITY_CLOUD_NINE)==0)
      && (CheckSideAbility(bw, sp, CHECK_ALL_BATTLER_ALIVE, 0, ABILITY_AIR_LOCK)==0))
@@ -472,7 +429,7 @@ u8 CalcSpeed(void *bw, struct BattleStruct *sp, int client1, int client2, int fl
 
     if (hold_effect1 == HOLD_EFFECT_RAISE_SPEED_IN_PINCH)
     {
-        if (GetBattlerAbility(sp, client1) == ABILITY_GLUTTONY)
+        if (ability1 == ABILITY_GLUTTONY)
         {
             hold_atk1 /= 2;
         }
@@ -554,7 +511,7 @@ u8 CalcSpeed(void *bw, struct BattleStruct *sp, int client1, int client2, int fl
 
     if (hold_effect2 == HOLD_EFFECT_RAISE_SPEED_IN_PINCH)
     {
-        if (GetBattlerAbility(sp, client2) == ABILITY_GLUTTONY)
+        if (ability2 == ABILITY_GLUTTONY)
         {
             hold_atk2 /= 2;
         }
@@ -639,24 +596,12 @@ u8 CalcSpeed(void *bw, struct BattleStruct *sp, int client1, int client2, int fl
         }
 
         // Handle Triage
-        if (GetBattlerAbility(sp, client1) == ABILITY_TRIAGE) {
-            for (i = 0; i < NELEMS(TriageMovesList); i++)
-            {
-                if (TriageMovesList[i] == move1) {
-                    priority1 = priority1 + 3;
-                    break;
-                }
-            }
+        if (GetBattlerAbility(sp, client1) == ABILITY_TRIAGE && MOVE_HAS_FLAG(move1, MOVE_FLAG_TRIAGE)) {
+            priority1 = priority1 + 3;
         }
 
-        if (GetBattlerAbility(sp, client2) == ABILITY_TRIAGE) {
-            for (i = 0; i < NELEMS(TriageMovesList); i++)
-            {
-                if (TriageMovesList[i] == move2) {
-                    priority2 = priority2 + 3;
-                    break;
-                }
-            }
+        if (GetBattlerAbility(sp, client2) == ABILITY_TRIAGE && MOVE_HAS_FLAG(move2, MOVE_FLAG_TRIAGE)) {
+            priority2 = priority2 + 3;
         }
     }
 
@@ -764,7 +709,6 @@ const u8 CriticalRateTable[] =
 int CalcCritical(void *bw, struct BattleStruct *sp, int attacker, int defender, int critical_count, u32 side_condition)
 {
     u16 temp;
-    u16 item;
     int hold_effect;
     u16 species;
     u32 defender_condition;
@@ -772,15 +716,16 @@ int CalcCritical(void *bw, struct BattleStruct *sp, int attacker, int defender,
     u32 move_effect;
     int multiplier = 1;
     int ability;
+    struct BattlerCalcSnapshot mon;
 
-    item = GetBattleMonItem(sp, attacker);
-    hold_effect = BattleItemDataGet(sp, item, 1);
+    FillBattlerCalcSnapshot(sp, attacker, &mon);
+    hold_effect = mon.item_held_effect;
 
-    species = sp->battlemon[attacker].species;
+    species = mon.species;
     defender_condition = sp->battlemon[defender].condition;
-    condition2 = sp->battlemon[attacker].condition2;
+    condition2 = mon.condition2;
     move_effect = sp->battlemon[defender].effect_of_moves;
-    ability = sp->battlemon[attacker].ability;
+    ability = sp->battlemon[attacker].ability; // not mon.ability, super luck and merciless have always ignored gastro acid here
 
     temp = (((condition2 & STATUS2_FLAG_FOCUS_ENERGY) != 0) * 2) + (hold_effect == HOLD_EFFECT_BOOST_CRITICAL_RATE) + critical_count + (ability == ABILITY_SUPER_LUCK)
          + (2 * ((hold_effect == HOLD_EFFECT_BOOST_CHANSEY_CRITICAL) && (species == SPECIES_CHANSEY)))
@@ -806,7 +751,7 @@ int CalcCritical(void *bw, struct BattleStruct *sp, int attacker, int defender,
         }
     }
 
-    if ((multiplier == 2) && (GetBattlerAbility(sp, attacker) == ABILITY_SNIPER))
+    if ((multiplier == 2) && (mon.ability == ABILITY_SNIPER))
     {
         multiplier = 3;
     }
@@ -1007,7 +952,7 @@ u16 gf_p_rand(const u16 denominator)
  */
 int ServerDoTypeCalcMod(void *bw UNUSED, struct BattleStruct *sp, int move_no, int move_type, int attack_client, int defence_client, int damage, u32 *flag)
 {
-    int i;
+    int i, j, rows[2];
     int modifier;
     u32 base_power;
     u8  eqp_a;
@@ -1065,48 +1010,26 @@ int ServerDoTypeCalcMod(void *bw UNUSED, struct BattleStruct *sp, int move_no, i
     }
     else
     {
-        i = 0;
-        while (TypeEffectivenessTable[i][0] != 0xff)
+        GetTypeEffectivenessRows(move_type,
+                                 BattlePokemonParamGet(sp, defence_client, BATTLE_MON_DATA_TYPE1, NULL),
+                                 BattlePokemonParamGet(sp, defence_client, BATTLE_MON_DATA_TYPE2, NULL),
+                                 ((sp->battlemon[defence_client].condition2 & STATUS2_FLAG_FORESIGHT) || (GetBattlerAbility(sp, attack_client) == ABILITY_SCRAPPY)), // handle foresight
+                                 rows);
+        for (j = 0; j < 2; j++)
         {
-            if (TypeEffectivenessTable[i][0] == 0xfe) // handle foresight
+            i = rows[j];
+            if (i < 0)
             {
-                if ((sp->battlemon[defence_client].condition2 & STATUS2_FLAG_FORESIGHT) || (GetBattlerAbility(sp, attack_client) == ABILITY_SCRAPPY))
-                {
-                    break;
-                }
-                else
-                {
-                    i++;
-                    continue;
-                }
+                continue;
             }
-            if (TypeEffectivenessTable[i][0] == move_type)
+            if (ShouldUseNormalTypeEffCalc(sp, attack_client, defence_client, i) == TRUE)
             {
-                if (TypeEffectivenessTable[i][1] == BattlePokemonParamGet(sp, defence_client, BATTLE_MON_DATA_TYPE1, NULL))
+                damage = TypeCheckCalc(sp, attack_client, TypeEffectivenessTable[i][2], damage, base_power, flag);
+                if (TypeEffectivenessTable[i][2] == 20) // seems to be useless, modifier isn't used elsewhere
                 {
-                    if (ShouldUseNormalTypeEffCalc(sp, attack_client, defence_client, i) == TRUE)
-                    {
-                        damage = TypeCheckCalc(sp, attack_client, TypeEffectivenessTable[i][2], damage, base_power, flag);
-                        if (TypeEffectivenessTable[i][2] == 20) // seems to be useless, modifier isn't used elsewhere
-                        {
-                            modifier *= 2;
-                        }
-                    }
-                }
-                if ((TypeEffectivenessTable[i][1] == BattlePokemonParamGet(sp, defence_client, BATTLE_MON_DATA_TYPE2, NULL))
-                 && (BattlePokemonParamGet(sp, defence_client, BATTLE_MON_DATA_TYPE1, NULL) != BattlePokemonParamGet(sp, defence_client, BATTLE_MON_DATA_TYPE2, NULL)))
-                {
-                    if (ShouldUseNormalTypeEffCalc(sp, attack_client, defence_client, i) == TRUE)
-                    {
-                        damage = TypeCheckCalc(sp, attack_client, TypeEffectivenessTable[i][2], damage, base_power, flag);
-                        if (TypeEffectivenessTable[i][2] == 20) // seems to be useless, modifier isn't used elsewhere
-                        {
-                            modifier *= 2;
-                        }
-                    }
+                    modifier *= 2;
                 }
             }
-            i++;
         }
     }
 
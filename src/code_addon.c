@@ -0,0 +1,38 @@
+#include "../include/types.h"
+#include "../include/code_addon.h"
+#include "../include/constants/file.h"
+#include "../include/constants/species.h"
+
+// ARC_CODE_ADDONS files that are read an entry at a time all through the game, copied into bss the first time one is
+// asked for and kept from then on.  each buffer is the size of the file armips/data builds for it, so nothing is ever
+// allocated for them
+static u16 sBaseExperienceList[MAX_SPECIES_INCLUDING_FORMS + 1]; // armips/data/baseexp.s
+static u8 sNumOfOWFormsPerMon[MAX_MON_NUM + 1]; // armips/data/monoverworlds.s
+
+struct CodeAddonBuffer
+{
+    void *data;
+    u32 size;
+};
+
+static const struct CodeAddonBuffer sCodeAddonBuffers[NUM_OF_CODE_ADDONS] =
+{
+    [CODE_ADDON_BASE_EXPERIENCE_LIST] = { sBaseExperienceList, sizeof(sBaseExperienceList) },
+    [CODE_ADDON_NUM_OF_OW_FORMS_PER_MON] = { sNumOfOWFormsPerMon, sizeof(sNumOfOWFormsPerMon) },
+};
+
+// bit per CODE_ADDON_* file already in its buffer
+static u32 sCodeAddonsLoaded;
+
+
+void *GetCodeAddonData(u32 file)
+{
+    GF_ASSERT(file < NUM_OF_CODE_ADDONS && sCodeAddonBuffers[file].data != NULL);
+
+    if (!(sCodeAddonsLoaded & (1 << file)))
+    {
+        ArchiveDataLoadOfs(sCodeAddonBuffers[file].data, ARC_CODE_ADDONS, file, 0, sCodeAddonBuffers[file].size);
+        sCodeAddonsLoaded |= 1 << file;
+    }
+    return sCodeAddonBuffers[file].data;
+}
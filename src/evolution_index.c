@@ -0,0 +1,80 @@
+#include "../include/types.h"
+#include "../include/pokemon.h"
+#include "../include/constants/file.h"
+
+// CODE_ADDON_EVOLUTION_INDEX, copied into bss the first time an evolution is checked and kept from then on.  a
+// species that can't evolve is turned away by the bitset, and one that can reads its evolutions straight out of here,
+// so GetMonEvolution never allocates or goes back to the file system
+static u32 sEvolutionIndex[EVOLUTION_INDEX_MAX_SIZE / 4];
+static BOOL sEvolutionIndexLoaded;
+
+/**
+ *  @brief load the evolution index into sEvolutionIndex if it isn't already
+ *
+ *  @return the index header
+ */
+static struct EvolutionIndexHeader *GetEvolutionIndex(void)
+{
+    struct EvolutionIndexHeader *header = (struct EvolutionIndexHeader *)sEvolutionIndex;
+    u32 words, size;
+
+    if (!sEvolutionIndexLoaded)
+    {
+        ArchiveDataLoadOfs(header, ARC_CODE_ADDONS, CODE_ADDON_EVOLUTION_INDEX, 0, sizeof(*header));
+        words = (header->species_count + 31) / 32;
+        size = sizeof(*header) + words * (sizeof(u32) + sizeof(u16)) + (header->evolving_count + 1) * sizeof(u16)
+             + header->evolution_count * sizeof(struct Evolution);
+        if (size <= sizeof(sEvolutionIndex))
+        {
+            ArchiveDataLoadOfs(sEvolutionIndex, ARC_CODE_ADDONS, CODE_ADDON_EVOLUTION_INDEX, 0, size);
+        }
+        else
+        {
+            // evo_index.py refuses to build an index this big, so this is a stale or foreign file
+            GF_ASSERT(FALSE);
+            header->species_count = 0;
+            header->evolving_count = 0;
+            header->evolution_count = 0;
+        }
+        sEvolutionIndexLoaded = TRUE;
+    }
+    return header;
+}
+
+BOOL LONG_CALL SpeciesHasEvolutions(u32 species)
+{
+    struct EvolutionIndexHeader *header = GetEvolutionIndex();
+    u32 *bitset = (u32 *)(header + 1);
+
+    if (species >= header->species_count)
+        return FALSE;
+    return (bitset[species / 32] >> (species % 32)) & 1;
+}
+
+struct Evolution *LONG_CALL GetSpeciesEvolutions(u32 species, int *count)
+{
+    struct EvolutionIndexHeader *header = GetEvolutionIndex();
+    u32 words = (header->species_count + 31) / 32;
+    u32 *bitset = (u32 *)(header + 1);
+    u16 *ranks = (u16 *)(bitset + words);
+    u16 *first = ranks + words;
+    u32 below, rank;
+
+    if (!SpeciesHasEvolutions(species))
+    {
+        *count = 0;
+        return NULL;
+    }
+
+    // the evolving species before this one in its bitset word
+    below = bitset[species / 32] & ((1u << (species % 32)) - 1);
+    rank = ranks[species / 32];
+    while (below != 0)
+    {
+        below &= below - 1;
+        rank++;
+    }
+
+    *count = first[rank + 1] - first[rank];
+    return (struct Evolution *)(first + header->evolving_count + 1) + first[rank];
+}
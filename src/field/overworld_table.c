@@ -1660,15 +1660,26 @@ struct OVERWORLD_TAG gOWTagToFileNum[] = // skip down a bit to see the parts tha
 };
 
 
+// sOWTagOrder, the gOWTagToFileNum entries in tag order.  scripts/check_overworld_tags.py writes it out when it checks
+// the table for duplicate tags.  the table itself keeps its order because the vanilla overlay code walks it too
+#include "../../build/field/overworld_tag_order.h"
+
+_Static_assert(NELEMS(sOWTagOrder) == NELEMS(gOWTagToFileNum) - 1, "sOWTagOrder is out of date with gOWTagToFileNum");
+
 // used for HoF/pokeathlon overworlds
 struct OVERWORLD_TAG *grab_overworld_ptr(u16 tag)
 {
-    int i = 0;
-    while (gOWTagToFileNum[i].tag != 0xFFFF)
+    int low = 0, high = NELEMS(sOWTagOrder) - 1, mid;
+
+    while (low <= high)
     {
-        if (gOWTagToFileNum[i].tag == tag)
-            return &gOWTagToFileNum[i];
-        i++;
+        mid = (low + high) / 2;
+        if (gOWTagToFileNum[sOWTagOrder[mid]].tag == tag)
+            return &gOWTagToFileNum[sOWTagOrder[mid]];
+        else if (gOWTagToFileNum[sOWTagOrder[mid]].tag < tag)
+            low = mid + 1;
+        else
+            high = mid - 1;
     }
     return &gOWTagToFileNum[2]; // default error failure
 }
@@ -177,26 +177,126 @@ void GetMoveDataTable(void *dest)
 }
 
 
+/**
+ *  @brief hot BattleMove fields kept resident by the move data cache below
+ */
+struct __attribute__((packed)) MoveDataCacheEntry
+{
+    /* 0x0 */ u16 effect;
+    /* 0x2 */ u8 split;
+    /* 0x3 */ u8 power;
+    /* 0x4 */ u8 type;
+    /* 0x5 */ u8 accuracy;
+    /* 0x6 */ s8 priority;
+    /* 0x7 */ u8 flag;
+}; // size = 0x8
+
+// moves loaded from ARC_MOVE_DATA per archive read while filling the cache
+#define MOVE_DATA_CACHE_CHUNK 64
+
+// lives in bss, so it starts out empty every time the code overlay is loaded
+static struct MoveDataCacheEntry sMoveDataCache[NUM_OF_MOVES + 1];
+static BOOL sMoveDataCacheLoaded;
+
+
+/**
+ *  @brief drop the move data cache so the next GetMoveData call reloads it from ARC_MOVE_DATA
+ */
+void InvalidateMoveDataCache(void)
+{
+    sMoveDataCacheLoaded = FALSE;
+}
+
+
+/**
+ *  @brief fill the move data cache from ARC_MOVE_DATA if it isn't already
+ *
+ *  the members of ARC_MOVE_DATA are back to back in the narc (see GetMoveDataTable), so the
+ *  table is read a chunk of moves at a time through member 0 instead of one archive load per move
+ */
+static void LoadMoveDataCache(void)
+{
+    struct BattleMove *bm;
+    int i, j, count;
+
+    if (sMoveDataCacheLoaded)
+    {
+        return;
+    }
+
+    bm = sys_AllocMemory(0, sizeof(struct BattleMove) * MOVE_DATA_CACHE_CHUNK);
+    for (i = 0; i < NUM_OF_MOVES + 1; i += MOVE_DATA_CACHE_CHUNK)
+    {
+        count = NUM_OF_MOVES + 1 - i;
+        if (count > MOVE_DATA_CACHE_CHUNK)
+        {
+            count = MOVE_DATA_CACHE_CHUNK;
+        }
+        ArchiveDataLoadOfs(bm, ARC_MOVE_DATA, 0, sizeof(struct BattleMove) * i, sizeof(struct BattleMove) * count);
+        for (j = 0; j < count; j++)
+        {
+            sMoveDataCache[i + j].effect = bm[j].effect;
+            sMoveDataCache[i + j].split = bm[j].split;
+            sMoveDataCache[i + j].power = bm[j].power;
+            sMoveDataCache[i + j].type = bm[j].type;
+            sMoveDataCache[i + j].accuracy = bm[j].accuracy;
+            sMoveDataCache[i + j].priority = bm[j].priority;
+            sMoveDataCache[i + j].flag = bm[j].flag;
+        }
+    }
+    sys_FreeMemoryEz(bm);
+
+    sMoveDataCacheLoaded = TRUE;
+}
+
+
 /**
  *  @brief get move data field requested from ARC_MOVE_DATA
  *
+ *  the fields in the move data cache are read straight from it; the rest still load the move from the archive
+ *
  *  @param id move index
  *  @param field MOVE_DATA_* constant requesting data
  *  @return requested data
  */
 u32 LONG_CALL GetMoveData(u16 id, u32 field)
 {
-    struct BattleMove *bm = sys_AllocMemory(0, sizeof(struct BattleMove));
-    ArchiveDataLoad(bm, ARC_MOVE_DATA, id);
+    struct BattleMove *bm;
     u32 ret = 0;
 
+    if (id <= NUM_OF_MOVES)
+    {
+        LoadMoveDataCache();
+
+        switch (field)
+        {
+        case MOVE_DATA_EFFECT:
+            return sMoveDataCache[id].effect;
+        case MOVE_DATA_PSS_SPLIT:
+            return sMoveDataCache[id].split;
+        case MOVE_DATA_BASE_POWER:
+            return sMoveDataCache[id].power;
+        case MOVE_DATA_TYPE:
+            return sMoveDataCache[id].type;
+        case MOVE_DATA_ACCURACY:
+            return sMoveDataCache[id].accuracy;
+        case MOVE_DATA_PRIORITY:
+            return sMoveDataCache[id].priority;
+        case MOVE_DATA_FLAGS:
+            return sMoveDataCache[id].flag;
+        }
+    }
+
+    bm = sys_AllocMemory(0, sizeof(struct BattleMove));
+    ArchiveDataLoad(bm, ARC_MOVE_DATA, id);
+
     switch (field)
     {
     case MOVE_DATA_EFFECT:
         ret = bm->effect;
         break;
     case MOVE_DATA_PSS_SPLIT:
-        ret = bm->effect;
+        ret = bm->split;
         break;
     case MOVE_DATA_BASE_POWER:
         ret = bm->power;
@@ -1,5 +1,6 @@
 #include "../include/types.h"
 #include "../include/battle.h"
+#include "../include/code_addon.h"
 #include "../include/config.h"
 #include "../include/debug.h"
 #include "../include/pokemon.h"
@@ -2662,6 +2663,82 @@ const struct FormData PokeFormDataTbl[]=
 
 extern u32 word_to_store_form_at;
 
+// PokeFormDataTbl indices grouped by species, built the first time a form lookup needs them.
+// a species' entries are sFormIndexEntries[sFormIndexBase[species]] up to sFormIndexEntries[sFormIndexBase[species + 1]]
+static u16 sFormIndexBase[MAX_MON_NUM + 2];
+static u16 sFormIndexEntries[NELEMS(PokeFormDataTbl)];
+// PokeFormDataTbl index + 1 for each form file past MAX_MON_NUM, 0 if no entry uses it
+static u16 sFormFileEntry[MAX_SPECIES_INCLUDING_FORMS - MAX_MON_NUM];
+static BOOL sFormIndexBuilt;
+
+/**
+ *  @brief build the species -> form entry and form file -> form entry indices from PokeFormDataTbl if they aren't already
+ */
+static void BuildFormIndex(void)
+{
+    u32 i, species, file;
+
+    if (sFormIndexBuilt)
+        return;
+
+    // count the entries of each species, then turn the counts into the species' end offsets
+    for (i = 0; i < NELEMS(PokeFormDataTbl); i++)
+    {
+        sFormIndexBase[PokeFormDataTbl[i].species + 1]++;
+    }
+    for (species = 1; species < NELEMS(sFormIndexBase); species++)
+    {
+        sFormIndexBase[species] += sFormIndexBase[species - 1];
+    }
+
+    // fill each species' slots back to front, which leaves sFormIndexBase[species] at its start and keeps table order
+    for (i = NELEMS(PokeFormDataTbl); i > 0; i--)
+    {
+        sFormIndexEntries[--sFormIndexBase[PokeFormDataTbl[i - 1].species + 1]] = i - 1;
+    }
+    for (species = 0; species < NELEMS(sFormIndexBase) - 1; species++)
+    {
+        sFormIndexBase[species] = sFormIndexBase[species + 1];
+    }
+    sFormIndexBase[NELEMS(sFormIndexBase) - 1] = NELEMS(PokeFormDataTbl);
+
+    // the first entry using a file wins, same as the table scan it replaces
+    for (i = 0; i < NELEMS(PokeFormDataTbl); i++)
+    {
+        file = PokeFormDataTbl[i].file - (MAX_MON_NUM + 1);
+        if (file < NELEMS(sFormFileEntry) && sFormFileEntry[file] == 0)
+        {
+            sFormFileEntry[file] = i + 1;
+        }
+    }
+
+    sFormIndexBuilt = TRUE;
+}
+
+/**
+ *  @brief find the PokeFormDataTbl entry for a species and form
+ *
+ *  @param species species index
+ *  @param form_no form number
+ *  @return matching PokeFormDataTbl entry; NULL if there is none
+ */
+static const struct FormData *GetFormDataEntry(u32 species, u32 form_no)
+{
+    u32 i;
+
+    BuildFormIndex();
+
+    if (species > MAX_MON_NUM)
+        return NULL;
+
+    for (i = sFormIndexBase[species]; i < sFormIndexBase[species + 1]; i++)
+    {
+        if (PokeFormDataTbl[sFormIndexEntries[i]].form_no == form_no)
+            return &PokeFormDataTbl[sFormIndexEntries[i]];
+    }
+    return NULL;
+}
+
 /**
  *  @brief set up the indices for the new form system pictures.  if necessary, loop through the form table, searching for the new form index to load sprites from
  *         this function does not account for existing forms already covered by otherpoke.narc
@@ -2680,15 +2757,13 @@ BOOL LONG_CALL GetOtherFormPic(MON_PIC *picdata, u16 mons_no, u8 dir, u8 col, u8
     if (!form_no)
         return FALSE;
 
-    for (u32 i = 0; i < NELEMS(PokeFormDataTbl); i++)
+    const struct FormData *entry = GetFormDataEntry(mons_no, form_no);
+    if (entry != NULL)
     {
-        if (mons_no == PokeFormDataTbl[i].species && form_no == PokeFormDataTbl[i].form_no)
-        {
-            picdata->arc_no = ARC_MON_PIC;
-            picdata->index_chr = (PokeFormDataTbl[i].file) * 6 + dir;
-            picdata->index_pal = (PokeFormDataTbl[i].file) * 6 + 4 + col;
-            return TRUE;
-        }
+        picdata->arc_no = ARC_MON_PIC;
+        picdata->index_chr = (entry->file) * 6 + dir;
+        picdata->index_pal = (entry->file) * 6 + 4 + col;
+        return TRUE;
     }
 
     return FALSE;
@@ -2703,7 +2778,7 @@ BOOL LONG_CALL GetOtherFormPic(MON_PIC *picdata, u16 mons_no, u8 dir, u8 col, u8
  */
 int LONG_CALL PokeOtherFormMonsNoGet(int mons_no, int form_no)
 {
-    u32 i;
+    const struct FormData *entry;
     switch (mons_no)
     {
     case SPECIES_DEOXYS:
@@ -2742,13 +2817,10 @@ int LONG_CALL PokeOtherFormMonsNoGet(int mons_no, int form_no)
         break;
     }
 
-    for (i = 0; i < NELEMS(PokeFormDataTbl); i++)
+    entry = GetFormDataEntry(mons_no, form_no);
+    if (entry != NULL)
     {
-        if (mons_no == PokeFormDataTbl[i].species && form_no == PokeFormDataTbl[i].form_no)
-        {
-            mons_no = PokeFormDataTbl[i].file;
-            break;
-        }
+        mons_no = entry->file;
     }
     return mons_no;
 }
@@ -2762,13 +2834,10 @@ int LONG_CALL PokeOtherFormMonsNoGet(int mons_no, int form_no)
  */
 u16 LONG_CALL GetSpeciesBasedOnForm(int mons_no, int form_no)
 {
-    for (u32 i = 0; i < NELEMS(PokeFormDataTbl); i++)
+    const struct FormData *entry = GetFormDataEntry(mons_no, form_no);
+    if (entry != NULL)
     {
-        if (mons_no == PokeFormDataTbl[i].species && form_no == PokeFormDataTbl[i].form_no)
-        {
-            mons_no = PokeFormDataTbl[i].file;
-            break;
-        }
+        mons_no = entry->file;
     }
     return mons_no;
 }
@@ -2784,13 +2853,11 @@ u16 LONG_CALL GetOriginalSpeciesBasedOnAdjustedForm(u32 mons_no)
     if (mons_no <= MAX_MON_NUM)
         return mons_no;
 
-    for (u32 i = 0; i < NELEMS(PokeFormDataTbl); i++)
+    BuildFormIndex();
+
+    if (mons_no - (MAX_MON_NUM + 1) < NELEMS(sFormFileEntry) && sFormFileEntry[mons_no - (MAX_MON_NUM + 1)])
     {
-        if (mons_no == PokeFormDataTbl[i].file)
-        {
-            mons_no = PokeFormDataTbl[i].species;
-            break;
-        }
+        mons_no = PokeFormDataTbl[sFormFileEntry[mons_no - (MAX_MON_NUM + 1)] - 1].species;
     }
     return mons_no;
 }
@@ -2805,7 +2872,7 @@ u16 LONG_CALL GetOriginalSpeciesBasedOnAdjustedForm(u32 mons_no)
  */
 u32 LONG_CALL PokeIconIndexGetByMonsNumber(u32 mons, u32 egg, u32 form_no)
 {
-    u32 i;
+    const struct FormData *entry;
     u32 pat = form_no;
 
     if (egg == 1)
@@ -2870,11 +2937,9 @@ u32 LONG_CALL PokeIconIndexGetByMonsNumber(u32 mons, u32 egg, u32 form_no)
         }
     }
 
-    for (i = 0; i < NELEMS(PokeFormDataTbl); i++)
-    {
-        if (mons == PokeFormDataTbl[i].species && form_no == PokeFormDataTbl[i].form_no)
-            return PokeFormDataTbl[i].file + 7;
-    }
+    entry = GetFormDataEntry(mons, form_no);
+    if (entry != NULL)
+        return entry->file + 7;
     return (7 + mons);
 }
 
@@ -2887,7 +2952,6 @@ u32 LONG_CALL PokeIconIndexGetByMonsNumber(u32 mons, u32 egg, u32 form_no)
 u16 LONG_CALL PokeIconCgxPatternGet(struct BoxPokemon *ppp)
 {
     u32 monsno;
-    u32 i;
 
     monsno = GetBoxMonData(ppp, MON_DATA_SPECIES_OR_EGG, NULL);
 
@@ -2905,11 +2969,9 @@ u16 LONG_CALL PokeIconCgxPatternGet(struct BoxPokemon *ppp)
         return GetBoxMonData(ppp, MON_DATA_FORM, NULL);
 
     default:
-        for (i = 0; i < NELEMS(PokeFormDataTbl); i++)
-        {
-            if (monsno == PokeFormDataTbl[i].species)
-                return GetBoxMonData(ppp, MON_DATA_FORM, NULL);
-        }
+        BuildFormIndex();
+        if (monsno <= MAX_MON_NUM && sFormIndexBase[monsno] != sFormIndexBase[monsno + 1])
+            return GetBoxMonData(ppp, MON_DATA_FORM, NULL);
         return 0;
     }
     return 0;
@@ -2925,7 +2987,7 @@ u16 LONG_CALL PokeIconCgxPatternGet(struct BoxPokemon *ppp)
  */
 u32 LONG_CALL PokeIconPalNumGet(u32 mons, u32 form, u32 isegg)
 {
-    u32 i;
+    const struct FormData *entry;
     
     if (isegg)
     {
@@ -2982,11 +3044,9 @@ u32 LONG_CALL PokeIconPalNumGet(u32 mons, u32 form, u32 isegg)
         {
             mons = 543 + form - 1;
         }
-        for (i = 0; i < NELEMS(PokeFormDataTbl); i++)
-        {
-            if (mons == PokeFormDataTbl[i].species && form == PokeFormDataTbl[i].form_no)
-                return PokeFormDataTbl[i].file;
-        }
+        entry = GetFormDataEntry(mons, form);
+        if (entry != NULL)
+            return entry->file;
     }
     return mons;
 }
@@ -3016,6 +3076,45 @@ u16 LONG_CALL GetPokemonOwNum(u16 species)
     return sSpeciesToOWGfx[species];
 }
 
+#ifdef HIDDEN_ABILITIES
+
+// hidden abilities are 9 bits wide:  the low 8 bits of each species' ability, then one bit per species for the 9th.
+// unpacked from CODE_ADDON_HIDDEN_ABILITY_LIST the first time one is asked for and kept from then on, so generating
+// wild and gift mons never has to go back to the file system for it
+#define HIDDEN_ABILITY_BITS 9
+
+static u8 sHiddenAbilityLow[MAX_SPECIES_INCLUDING_FORMS + 1];
+static u8 sHiddenAbilityHigh[(MAX_SPECIES_INCLUDING_FORMS + 8) / 8];
+static BOOL sHiddenAbilitiesLoaded;
+
+/**
+ *  @brief pack the hidden ability list into sHiddenAbilityLow/sHiddenAbilityHigh if it isn't already
+ */
+static void LoadHiddenAbilities(void)
+{
+    u16 *hiddenAbilityTable;
+    u32 species;
+
+    if (sHiddenAbilitiesLoaded)
+        return;
+
+    hiddenAbilityTable = ArchiveDataLoadMalloc(ARC_CODE_ADDONS, CODE_ADDON_HIDDEN_ABILITY_LIST, 0);
+    for (species = 0; species <= MAX_SPECIES_INCLUDING_FORMS; species++)
+    {
+        GF_ASSERT(hiddenAbilityTable[species] < (1 << HIDDEN_ABILITY_BITS));
+        sHiddenAbilityLow[species] = hiddenAbilityTable[species] & 0xFF;
+        if (hiddenAbilityTable[species] & 0x100)
+        {
+            sHiddenAbilityHigh[species / 8] |= 1 << (species % 8);
+        }
+    }
+    sys_FreeMemoryEz(hiddenAbilityTable);
+
+    sHiddenAbilitiesLoaded = TRUE;
+}
+
+#endif // HIDDEN_ABILITIES
+
 /**
  *  @brief grab the hidden ability for a species and form
  *
@@ -3026,15 +3125,12 @@ u16 LONG_CALL GetPokemonOwNum(u16 species)
 u16 LONG_CALL GetMonHiddenAbility(u16 species, u32 form)
 {
 #ifdef HIDDEN_ABILITIES
-    u16 ability = 0;
-    u16* hiddenAbilityTable = sys_AllocMemory(0, sizeof(u16) * MAX_SPECIES_INCLUDING_FORMS);
+    LoadHiddenAbilities();
 
     species = PokeOtherFormMonsNoGet(species, form);
-    ArchiveDataLoad(hiddenAbilityTable, ARC_CODE_ADDONS, CODE_ADDON_HIDDEN_ABILITY_LIST);
-    ability = hiddenAbilityTable[species];
-    sys_FreeMemoryEz(hiddenAbilityTable);
-
-    return ability;
+    if (species > MAX_SPECIES_INCLUDING_FORMS)
+        return 0;
+    return sHiddenAbilityLow[species] | (((sHiddenAbilityHigh[species / 8] >> (species % 8)) & 1) << 8);
 #else
     return 0;
 #endif // HIDDEN_ABILITIES
@@ -3114,16 +3210,11 @@ void LONG_CALL SetBoxMonAbility(struct BoxPokemon *boxmon) // actually takes box
  */
 u32 LONG_CALL GetSpeciesBaseExp(u32 species, u32 form)
 {
-    u16 *baseExpTable = sys_AllocMemory(0, sizeof(u16) * MAX_SPECIES_INCLUDING_FORMS);
-    u16 baseExp;
+    u16 *baseExpTable = GetCodeAddonData(CODE_ADDON_BASE_EXPERIENCE_LIST);
     
     species = PokeOtherFormMonsNoGet(species, form); // for whatever reason alternate formes can have different base experiences
 
-    ArchiveDataLoad(baseExpTable, ARC_CODE_ADDONS, CODE_ADDON_BASE_EXPERIENCE_LIST);
-    baseExp = baseExpTable[species];
-    sys_FreeMemoryEz(baseExpTable);
-
-    return baseExp;
+    return baseExpTable[species];
 }
 
 /**
@@ -3578,34 +3669,24 @@ BOOL LONG_CALL Party_TryResetShaymin(struct Party *party, int min_max, const str
  */
 u8 LONG_CALL LoadEggMoves(struct PartyPokemon *pokemon, u16 *dest)
 {
-    u16 n;
-    u16 *kowaza_list;
-    u16 offset;
+    struct EggMoveIndexEntry header, entry;
     u16 species;
-    u16 i;
-
-    kowaza_list = sys_AllocMemory(0, NUM_EGG_MOVES_TOTAL*2);
-    ArchiveDataLoad(kowaza_list, ARC_EGG_MOVES, 0);
-
-    n = 0;
-    offset = 0;
 
     species = PokeOtherFormMonsNoGet(GetMonData(pokemon, MON_DATA_SPECIES, NULL), GetMonData(pokemon, MON_DATA_FORM, NULL));
-    for (i = 0; i < NUM_EGG_MOVES_TOTAL; i++) {
-        if (species + 20000 == kowaza_list[i]) {
-            offset = i + 1;
-            break;
-        }
+
+    // only the index entry and the species' own moves are read, not the whole egg move list
+    ArchiveDataLoadOfs(&header, ARC_EGG_MOVES, 1, 0, sizeof(header));
+    if (species >= header.offset) {
+        return 0;
     }
-    for (i = 0; i < EGG_MOVES_PER_MON; i++) {
-        if (kowaza_list[offset + i] > 20000) {
-            break;
-        }
-        dest[i] = kowaza_list[offset + i];
-        n++;
+    ArchiveDataLoadOfs(&entry, ARC_EGG_MOVES, 1, sizeof(entry) * (species + 1), sizeof(entry));
+    if (entry.count > EGG_MOVES_PER_MON) {
+        entry.count = EGG_MOVES_PER_MON;
     }
-    sys_FreeMemoryEz(kowaza_list);
-    return n;
+    if (entry.count != 0) {
+        ArchiveDataLoadOfs(dest, ARC_EGG_MOVES, 0, entry.offset * 2, entry.count * 2);
+    }
+    return entry.count;
 }
 
 /**
@@ -3690,6 +3771,7 @@ u16 LONG_CALL GetMonEvolution(struct Party *party, struct PartyPokemon *pokemon,
     u8 beauty; // for Feebas, but queried unconditionally.
     u16 pid_hi = 0;
     struct Evolution *evoTable;
+    int evoCount;
     int method_local;
     u32 form = GetMonData(pokemon, MON_DATA_FORM, NULL);
     u32 lowkey = 0;
@@ -3697,6 +3779,12 @@ u16 LONG_CALL GetMonEvolution(struct Party *party, struct PartyPokemon *pokemon,
     struct PartyPokemon *ppFromParty = NULL;
 
     species = GetMonData(pokemon, MON_DATA_SPECIES, NULL);
+
+    // most checks are for mons that can't evolve at all, so turn those away before reading anything else
+    if (!SpeciesHasEvolutions(PokeOtherFormMonsNoGet(species, form))) {
+        return SPECIES_NONE;
+    }
+
     heldItem = GetMonData(pokemon, MON_DATA_HELD_ITEM, NULL);
     pid = GetMonData(pokemon, MON_DATA_PERSONALITY, NULL);
     beauty = GetMonData(pokemon, MON_DATA_BEAUTY, NULL);
@@ -3718,14 +3806,13 @@ u16 LONG_CALL GetMonEvolution(struct Party *party, struct PartyPokemon *pokemon,
     
     species = PokeOtherFormMonsNoGet(species, form); // factor in form into species to cover shit like galarian corsola + cap pikachu that can't evolve
 
-    evoTable = sys_AllocMemory(0, MAX_EVOS_PER_POKE * sizeof(struct Evolution));
-    ArchiveDataLoad(evoTable, ARC_EVOLUTIONS, species);
+    evoTable = GetSpeciesEvolutions(species, &evoCount);
 
     switch (context) {
     case EVOCTX_LEVELUP:
         level = (u8)GetMonData(pokemon, MON_DATA_LEVEL, NULL);
         friendship = (u16)GetMonData(pokemon, MON_DATA_FRIENDSHIP, NULL);
-        for (i = 0; i < MAX_EVOS_PER_POKE; i++) {
+        for (i = 0; i < evoCount; i++) {
             switch (evoTable[i].method) {
             case EVO_NONE:
                 break;
@@ -4009,7 +4096,7 @@ u16 LONG_CALL GetMonEvolution(struct Party *party, struct PartyPokemon *pokemon,
         }
         break;
     case EVOCTX_TRADE:
-        for (i = 0; i < MAX_EVOS_PER_POKE; i++) {
+        for (i = 0; i < evoCount; i++) {
             switch (evoTable[i].method) {
             case EVO_TRADE:
                 GET_TARGET_AND_SET_FORM;
@@ -4035,7 +4122,7 @@ u16 LONG_CALL GetMonEvolution(struct Party *party, struct PartyPokemon *pokemon,
         break;
     case EVOCTX_ITEM_CHECK:
     case EVOCTX_ITEM_USE:
-        for (i = 0; i < MAX_EVOS_PER_POKE; i++) {
+        for (i = 0; i < evoCount; i++) {
             if (evoTable[i].method == EVO_STONE && usedItem == evoTable[i].param) {
                 GET_TARGET_AND_SET_FORM;
                 *method_ret = 0;
@@ -4054,10 +4141,47 @@ u16 LONG_CALL GetMonEvolution(struct Party *party, struct PartyPokemon *pokemon,
         }
         break;
     }
-    sys_FreeMemoryEz(evoTable);
     return target;
 }
 
+/**
+ *  @brief check every member of a party for an evolution in one call.  eggs and species that can't evolve are
+ *         skipped without touching the rest of their data
+ *
+ *  @param party Party to check
+ *  @param context EVOCTX_* constant deciding which evolution methods to check
+ *  @param usedItem item used on the party, if applicable
+ *  @param targets array of 6, filled with each member's target species or SPECIES_NONE
+ *  @param methods array of 6 to store each member's evolution method in, or NULL
+ *  @return bitmask of the party slots that have an evolution
+ */
+u32 LONG_CALL GetPartyEvolutions(struct Party *party, u8 context, u16 usedItem, u16 *targets, int *methods)
+{
+    struct PartyPokemon *pokemon;
+    u32 species, evolving = 0;
+    int i;
+
+    for (i = 0; i < 6; i++)
+    {
+        targets[i] = SPECIES_NONE;
+        if (methods != NULL)
+            methods[i] = 0;
+    }
+
+    for (i = 0; i < party->count; i++)
+    {
+        pokemon = PokeParty_GetMemberPointer(party, i);
+        species = PokeOtherFormMonsNoGet(GetMonData(pokemon, MON_DATA_SPECIES, NULL), GetMonData(pokemon, MON_DATA_FORM, NULL));
+        if (!SpeciesHasEvolutions(species) || GetMonData(pokemon, MON_DATA_IS_EGG, NULL))
+            continue;
+
+        targets[i] = GetMonEvolution(party, pokemon, context, usedItem, methods != NULL ? &methods[i] : NULL);
+        if (targets[i] != SPECIES_NONE)
+            evolving |= 1 << i;
+    }
+    return evolving;
+}
+
 /**
  *  @brief grab the sex given species, pid, and form
  *
@@ -4127,8 +4251,7 @@ u16 LONG_CALL get_mon_ow_tag(u16 species, u32 form, u32 isFemale)
 
     ret = get_ow_data_file_num(species) + adjustment;
 
-    u8 *form_table = sys_AllocMemory(0, MAX_MON_NUM);
-    ArchiveDataLoad(form_table, ARC_CODE_ADDONS, CODE_ADDON_NUM_OF_OW_FORMS_PER_MON);
+    u8 *form_table = GetCodeAddonData(CODE_ADDON_NUM_OF_OW_FORMS_PER_MON);
 
     if (species == SPECIES_PIKACHU) // pikachu forms take gender adjustment into account and are looser with restrictions
     {
@@ -4147,8 +4270,6 @@ u16 LONG_CALL get_mon_ow_tag(u16 species, u32 form, u32 isFemale)
         ret += form;
     else if (isFemale && gDimorphismTable[species-1])
         ret += isFemale;
-    
-    sys_FreeMemoryEz(form_table);
 
     return ret;
 }
@@ -4393,7 +4514,7 @@ void LONG_CALL CreateBoxMonData(struct BoxPokemon *boxmon, int species, int leve
  */
 bool8 LONG_CALL RevertFormChange(struct PartyPokemon *pp, u16 species, u8 form_no)
 {
-    u32 i;
+    const struct FormData *entry;
     int work = 0;
 
     // use this chance to make bad poisoning normal poison at the end of battle
@@ -4405,24 +4526,22 @@ bool8 LONG_CALL RevertFormChange(struct PartyPokemon *pp, u16 species, u8 form_n
         SetMonData(pp, MON_DATA_STATUS, &work);
     }
 
-    for (i = 0; i < NELEMS(PokeFormDataTbl); i++)
-    {
-        if (species == PokeFormDataTbl[i].species && form_no == PokeFormDataTbl[i].form_no && PokeFormDataTbl[i].need_rev)
-        {
-            if (species == SPECIES_DARMANITAN && form_no == 3)
-                work = 1;
-            else if (species == SPECIES_NECROZMA)
-                work = form_no-2;
-            else if (species == SPECIES_GRENINJA)
-                work = 1;
-            else if (species == SPECIES_MINIOR)
-                work = form_no-7;
-            else if (species == SPECIES_ZYGARDE)
-                work = form_no-2;
-
-            SetMonData(pp, MON_DATA_FORM, &work);
-            return TRUE;
-        }
+    entry = GetFormDataEntry(species, form_no);
+    if (entry != NULL && entry->need_rev)
+    {
+        if (species == SPECIES_DARMANITAN && form_no == 3)
+            work = 1;
+        else if (species == SPECIES_NECROZMA)
+            work = form_no-2;
+        else if (species == SPECIES_GRENINJA)
+            work = 1;
+        else if (species == SPECIES_MINIOR)
+            work = form_no-7;
+        else if (species == SPECIES_ZYGARDE)
+            work = form_no-2;
+
+        SetMonData(pp, MON_DATA_FORM, &work);
+        return TRUE;
     }
     return FALSE;
 }
@@ -0,0 +1,460 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include "battlesim.h"
+
+// host driver for the battle calculators in src/battle.  runs turns of one battler attacking another and reports
+// how often the attacker moves first, lands a critical hit and knocks the defender out, plus the damage spread
+
+#define DEFAULT_TURNS 1000000
+#define DEFAULT_MOVE_DIR "build/a011"
+#define DEFAULT_BUILD_DIR "build"
+
+static void Usage(void)
+{
+    fprintf(stderr,
+        "Usage: battlesim [options]\n"
+        "\n"
+        "  -n TURNS     turns to simulate (default %d)\n"
+        "  -j JOBS      worker processes (default 1)\n"
+        "  -s SEED      random seed (default 1)\n"
+        "  -m DIR       move data files built by armips/data/moves.s (default " DEFAULT_MOVE_DIR ").\n"
+        "               made up moves are used if the directory doesn't exist\n"
+        "  -w WEATHER   rain, sand, sun, hail or fog\n"
+        "  -a BATTLER   attacker\n"
+        "  -d BATTLER   defender\n"
+        "  -c           run the host checks instead, which compare the lookup tables in src/ with the code they\n"
+        "               replaced, and exit nonzero if any of them disagree\n"
+        "  -b DIR       build directory the checks read built files from (default " DEFAULT_BUILD_DIR ").  the checks\n"
+        "               that need a file that isn't there are skipped\n"
+        "\n"
+        "without -a and -d, both battlers are drawn at random every turn, which makes a benchmark of the calculators.\n"
+        "the checksum only depends on the seed and the turn count, so it changes when their results do.\n"
+        "\n"
+        "BATTLER is a comma separated list of key=value, all game ids:\n"
+        "  species level hp maxhp atk def spe spa spd ability item move sex status\n"
+        "  type1 type2 (a type name or id)\n"
+        "e.g. -a level=50,atk=150,type1=fire,move=53 -d level=50,hp=160,def=100,spd=100,type1=grass\n",
+        DEFAULT_TURNS);
+}
+
+static void SetBattlerDefaults(struct SimBattler *battler)
+{
+    memset(battler, 0, sizeof(*battler));
+    battler->species = 1;
+    battler->level = 50;
+    battler->hp = battler->maxhp = 150;
+    battler->attack = battler->defense = battler->speed = battler->spatk = battler->spdef = 100;
+}
+
+static int ParseType(const char *value)
+{
+    char *end;
+    long type = strtol(value, &end, 0);
+
+    if (*end == '\0')
+        return (int)type;
+    return SimTypeFromName(value);
+}
+
+static int ParseBattler(const char *spec, struct SimBattler *battler)
+{
+    char *copy = strdup(spec);
+    char *item, *value;
+    int maxhp_set = 0, hp_set = 0;
+
+    for (item = strtok(copy, ","); item != NULL; item = strtok(NULL, ","))
+    {
+        value = strchr(item, '=');
+        if (value == NULL)
+        {
+            fprintf(stderr, "battlesim: expected key=value, got \"%s\"\n", item);
+            free(copy);
+            return -1;
+        }
+        *value++ = '\0';
+
+        if (strcmp(item, "type1") == 0 || strcmp(item, "type2") == 0)
+        {
+            int type = ParseType(value);
+            if (type < 0)
+            {
+                fprintf(stderr, "battlesim: unknown type \"%s\"\n", value);
+                free(copy);
+                return -1;
+            }
+            if (item[4] == '1')
+                battler->type1 = battler->type2 = type; // a single type battler unless type2 is given too
+            else
+                battler->type2 = type;
+            continue;
+        }
+
+        int number = (int)strtol(value, NULL, 0);
+        if (strcmp(item, "species") == 0)
+            battler->species = number;
+        else if (strcmp(item, "level") == 0)
+            battler->level = number;
+        else if (strcmp(item, "hp") == 0)
+            battler->hp = number, hp_set = 1;
+        else if (strcmp(item, "maxhp") == 0)
+            battler->maxhp = number, maxhp_set = 1;
+        else if (strcmp(item, "atk") == 0)
+            battler->attack = number;
+        else if (strcmp(item, "def") == 0)
+            battler->defense = number;
+        else if (strcmp(item, "spe") == 0)
+            battler->speed = number;
+        else if (strcmp(item, "spa") == 0)
+            battler->spatk = number;
+        else if (strcmp(item, "spd") == 0)
+            battler->spdef = number;
+        else if (strcmp(item, "ability") == 0)
+            battler->ability = number;
+        else if (strcmp(item, "item") == 0)
+            battler->item = number;
+        else if (strcmp(item, "move") == 0)
+            battler->move = number;
+        else if (strcmp(item, "sex") == 0)
+            battler->sex = number;
+        else if (strcmp(item, "status") == 0)
+            battler->condition = number;
+        else
+        {
+            fprintf(stderr, "battlesim: unknown battler key \"%s\"\n", item);
+            free(copy);
+            return -1;
+        }
+    }
+
+    // hp on its own means a battler at full health
+    if (hp_set && !maxhp_set)
+        battler->maxhp = battler->hp;
+    else if (maxhp_set && !hp_set)
+        battler->hp = battler->maxhp;
+
+    free(copy);
+    return 0;
+}
+
+/**
+ * Loads move_000, move_001, ... from dir.  Returns the number of moves loaded.
+ */
+static int LoadMoveData(const char *dir)
+{
+    char path[4096];
+    unsigned char data[64];
+    uint32_t move;
+
+    for (move = 0; ; move++)
+    {
+        snprintf(path, sizeof(path), "%s/move_%03u", dir, move);
+        FILE *file = fopen(path, "rb");
+        if (file == NULL)
+            break;
+        size_t size = fread(data, 1, sizeof(data), file);
+        fclose(file);
+        if (SimSetMoveData(move, data, (uint32_t)size) != 0)
+            break;
+    }
+    return (int)move;
+}
+
+static void MergeStats(struct SimStats *total, const struct SimStats *stats)
+{
+    total->turns += stats->turns;
+    total->attacker_first += stats->attacker_first;
+    total->criticals += stats->criticals;
+    total->knockouts += stats->knockouts;
+    total->damage_sum += stats->damage_sum;
+    if (stats->damage_min < total->damage_min)
+        total->damage_min = stats->damage_min;
+    if (stats->damage_max > total->damage_max)
+        total->damage_max = stats->damage_max;
+    total->checksum += stats->checksum;
+}
+
+static void RunJob(const struct SimConfig *base, int job, int jobs, struct SimStats *stats)
+{
+    struct SimConfig config = *base;
+    uint64_t extra = base->turns % jobs;
+
+    // contiguous ranges of turns, the first turns % jobs jobs taking one extra
+    config.first_turn = base->first_turn + base->turns / jobs * job + ((uint64_t)job < extra ? (uint64_t)job : extra);
+    config.turns = base->turns / jobs + ((uint64_t)job < extra);
+    SimRun(&config, stats);
+}
+
+#ifdef _WIN32
+
+static int RunJobs(const struct SimConfig *config, int jobs, struct SimStats *total)
+{
+    struct SimStats stats;
+
+    for (int job = 0; job < jobs; job++)
+    {
+        RunJob(config, job, jobs, &stats);
+        MergeStats(total, &stats);
+    }
+    return 0;
+}
+
+#else
+
+// each worker is its own process, so the battle code's globals never need to be shared between threads
+static int RunJobs(const struct SimConfig *config, int jobs, struct SimStats *total)
+{
+    int (*pipes)[2] = calloc(jobs, sizeof(*pipes));
+    pid_t *pids = calloc(jobs, sizeof(*pids));
+    struct SimStats stats;
+    int job, ret = 0;
+
+    for (job = 0; job < jobs; job++)
+    {
+        if (pipe(pipes[job]) != 0 || (pids[job] = fork()) < 0)
+        {
+            fprintf(stderr, "battlesim: unable to start worker: %s\n", strerror(errno));
+            exit(1);
+        }
+        if (pids[job] == 0)
+        {
+            close(pipes[job][0]);
+            RunJob(config, job, jobs, &stats);
+            _exit(write(pipes[job][1], &stats, sizeof(stats)) == sizeof(stats) ? 0 : 1);
+        }
+        close(pipes[job][1]);
+    }
+
+    for (job = 0; job < jobs; job++)
+    {
+        int status;
+        if (read(pipes[job][0], &stats, sizeof(stats)) == sizeof(stats))
+            MergeStats(total, &stats);
+        else
+            ret = -1;
+        close(pipes[job][0]);
+        if (waitpid(pids[job], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            ret = -1;
+    }
+
+    free(pipes);
+    free(pids);
+    return ret;
+}
+
+#endif // _WIN32
+
+/**
+ *  @brief read a whole file into a buffer that is never freed
+ *
+ *  @param path file to read
+ *  @param size filled with the file size
+ *  @return the file contents, NULL if the file couldn't be read
+ */
+static void *ReadWholeFile(const char *path, uint32_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    void *data = NULL;
+    long length;
+
+    if (file == NULL)
+        return NULL;
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        data = malloc(length ? (size_t)length : 1);
+        if (data != NULL && fread(data, 1, (size_t)length, file) != (size_t)length)
+        {
+            free(data);
+            data = NULL;
+        }
+        *size = (uint32_t)length;
+    }
+    fclose(file);
+    return data;
+}
+
+/**
+ *  @brief hand the evolution files and the evolution index from the build directory to the checks
+ *
+ *  @param build_dir build directory
+ *  @return number of evolution files loaded
+ */
+static int LoadEvolutionData(const char *build_dir)
+{
+    char path[4096];
+    uint32_t species, size;
+    void *data;
+
+    snprintf(path, sizeof(path), "%s/a028/8_10", build_dir);
+    data = ReadWholeFile(path, &size);
+    if (data == NULL)
+        return 0;
+    SimSetEvolutionIndex(data, size);
+
+    for (species = 0; ; species++)
+    {
+        snprintf(path, sizeof(path), "%s/a034/evodata_%04u", build_dir, species);
+        data = ReadWholeFile(path, &size);
+        if (data == NULL)
+            break;
+        if (SimSetEvolutionFile(species, data, size) != 0)
+        {
+            free(data);
+            break;
+        }
+    }
+    return (int)species;
+}
+
+/**
+ *  @brief run the host checks and print one line per check
+ *
+ *  @param build_dir build directory to read built files from
+ *  @return 0 if every check passed, 1 otherwise
+ */
+static int RunChecks(const char *build_dir)
+{
+    struct SimCheckResult results[SIM_MAX_CHECKS];
+    int count, failed = 0;
+
+    if (LoadEvolutionData(build_dir) == 0)
+        fprintf(stderr, "battlesim: no evolution index and files in %s/a028 and %s/a034\n", build_dir, build_dir);
+
+    count = SimRunChecks(results);
+    for (int i = 0; i < count; i++)
+    {
+        if (results[i].skipped != NULL)
+        {
+            printf("%-32s skipped: %s\n", results[i].name, results[i].skipped);
+            continue;
+        }
+        printf("%-32s %12llu cases %10llu failures%s\n", results[i].name, (unsigned long long)results[i].cases,
+               (unsigned long long)results[i].failures, results[i].failures ? "  FAILED" : "");
+        if (results[i].failures)
+            failed = 1;
+    }
+    return failed;
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+    struct SimConfig config;
+    struct SimStats total;
+    const char *move_dir = DEFAULT_MOVE_DIR;
+    const char *build_dir = DEFAULT_BUILD_DIR;
+    int jobs = 1;
+    int have_attacker = 0, have_defender = 0, checks = 0;
+    uint32_t weather;
+
+    memset(&config, 0, sizeof(config));
+    config.seed = 1;
+    config.turns = DEFAULT_TURNS;
+    SetBattlerDefaults(&config.battler[0]);
+    SetBattlerDefaults(&config.battler[1]);
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        if (strcmp(arg, "-c") == 0)
+        {
+            checks = 1;
+            continue;
+        }
+        if (arg[0] != '-' || arg[1] == '\0' || arg[2] != '\0' || i + 1 >= argc)
+        {
+            Usage();
+            return 1;
+        }
+        const char *value = argv[++i];
+        switch (arg[1])
+        {
+        case 'n':
+            config.turns = strtoull(value, NULL, 0);
+            break;
+        case 'j':
+            jobs = atoi(value);
+            break;
+        case 's':
+            config.seed = (uint32_t)strtoul(value, NULL, 0);
+            break;
+        case 'm':
+            move_dir = value;
+            break;
+        case 'b':
+            build_dir = value;
+            break;
+        case 'w':
+            weather = SimWeatherFromName(value);
+            if (weather == 0)
+            {
+                fprintf(stderr, "battlesim: unknown weather \"%s\"\n", value);
+                return 1;
+            }
+            config.field_condition |= weather;
+            break;
+        case 'a':
+            if (ParseBattler(value, &config.battler[0]) != 0)
+                return 1;
+            have_attacker = 1;
+            break;
+        case 'd':
+            if (ParseBattler(value, &config.battler[1]) != 0)
+                return 1;
+            have_defender = 1;
+            break;
+        default:
+            Usage();
+            return 1;
+        }
+    }
+    if (checks)
+        return RunChecks(build_dir);
+    if (jobs < 1)
+        jobs = 1;
+    config.random_battlers = !have_attacker && !have_defender;
+
+    int moves = LoadMoveData(move_dir);
+    if (moves == 0)
+    {
+        fprintf(stderr, "battlesim: no move data in %s, using made up moves\n", move_dir);
+        SimUseSyntheticMoves(config.seed);
+    }
+
+    memset(&total, 0, sizeof(total));
+    total.damage_min = UINT32_MAX;
+
+    double start = Now();
+    if (RunJobs(&config, jobs, &total) != 0)
+    {
+        fprintf(stderr, "battlesim: a worker failed\n");
+        return 1;
+    }
+    double elapsed = Now() - start;
+
+    if (total.turns == 0)
+        return 0;
+
+    printf("%llu turns in %.3f s on %d job%s (%.2fM turns/s, %.2fM calculator calls/s)\n",
+           (unsigned long long)total.turns, elapsed, jobs, jobs == 1 ? "" : "s",
+           total.turns / elapsed / 1e6, total.turns * 3 / elapsed / 1e6);
+    printf("attacker moved first: %.2f%%\n", 100.0 * total.attacker_first / total.turns);
+    printf("critical hits:        %.2f%%\n", 100.0 * total.criticals / total.turns);
+    printf("knocked out:          %.2f%%\n", 100.0 * total.knockouts / total.turns);
+    printf("damage:               min %u, mean %.2f, max %u\n",
+           total.damage_min, (double)total.damage_sum / total.turns, total.damage_max);
+    printf("checksum:             %016llx\n", (unsigned long long)total.checksum);
+    return 0;
+}
@@ -0,0 +1,136 @@
+#ifndef BATTLESIM_H
+#define BATTLESIM_H
+
+#include <stdint.h>
+
+// the interface between the driver, which only sees the C library, and sim.c, which only sees the game headers
+
+/**
+ *  @brief one side of the simulated matchup.  everything is a raw game value (species, ability, item and move ids)
+ */
+struct SimBattler
+{
+    int species;
+    int level;
+    int hp;
+    int maxhp;
+    int attack;
+    int defense;
+    int speed;
+    int spatk;
+    int spdef;
+    int type1;
+    int type2;
+    int ability;
+    int item;
+    int move;
+    int sex;
+    int condition;
+};
+
+struct SimConfig
+{
+    uint32_t seed;
+    uint64_t first_turn;            /**< index of the first turn to run, so a job's turns match a single process run */
+    uint64_t turns;
+    int random_battlers;            /**< draw new battlers every turn instead of using battler[] */
+    uint32_t field_condition;       /**< FIELD_STATUS_* and WEATHER_* flags */
+    struct SimBattler battler[2];   /**< attacker, defender */
+};
+
+struct SimStats
+{
+    uint64_t turns;
+    uint64_t attacker_first;
+    uint64_t criticals;
+    uint64_t knockouts;
+    uint64_t damage_sum;
+    uint32_t damage_min;
+    uint32_t damage_max;
+    uint64_t checksum;              /**< sum of a hash of every turn's index and result, so it doesn't depend on the job split */
+};
+
+/**
+ *  @brief outcome of one of the host checks
+ */
+struct SimCheckResult
+{
+    const char *name;
+    uint64_t cases;                 /**< inputs compared */
+    uint64_t failures;              /**< inputs where the two sides disagreed */
+    const char *skipped;            /**< why the check didn't run, NULL if it did */
+};
+
+#define SIM_MAX_CHECKS 16
+
+// in sim.c
+/**
+ *  @brief set one move's data from a file built into a011
+ *
+ *  @param move move index
+ *  @param data file contents
+ *  @param size file size
+ *  @return 0 on success, -1 if move is past the end of the move table
+ */
+int SimSetMoveData(uint32_t move, const void *data, uint32_t size);
+
+/**
+ *  @brief fill the move table with made up damaging moves, for when there is no built move data to load
+ *
+ *  @param seed random seed
+ */
+void SimUseSyntheticMoves(uint32_t seed);
+
+/**
+ *  @brief look a type up by its lowercase name
+ *
+ *  @param name type name, e.g. "fire"
+ *  @return TYPE_* constant, -1 if there is no such type
+ */
+int SimTypeFromName(const char *name);
+
+/**
+ *  @brief look a weather up by its lowercase name
+ *
+ *  @param name weather name, e.g. "rain"
+ *  @return WEATHER_* flags, 0 if there is no such weather
+ */
+uint32_t SimWeatherFromName(const char *name);
+
+/**
+ *  @brief run config->turns turns from config->first_turn on:  speed check, critical hit roll, damage calc, type chart
+ *         and damage roll.  every turn is seeded from config->seed and its own index
+ *
+ *  @param config what to simulate
+ *  @param stats filled with the results
+ */
+void SimRun(const struct SimConfig *config, struct SimStats *stats);
+
+// in checks.c
+/**
+ *  @brief set one species' evolution file from a034, for the evolution index check
+ *
+ *  @param species species index
+ *  @param data file contents, which have to stay around until the checks are done
+ *  @param size file size
+ *  @return 0 on success, -1 if species is past the last species
+ */
+int SimSetEvolutionFile(uint32_t species, const void *data, uint32_t size);
+
+/**
+ *  @brief set the evolution index code addon (a028 member 8_10), for the evolution index check
+ *
+ *  @param data file contents, which have to stay around until the checks are done
+ *  @param size file size
+ */
+void SimSetEvolutionIndex(const void *data, uint32_t size);
+
+/**
+ *  @brief compare the precomputed tables and caches in src/ against the code they replaced
+ *
+ *  @param results filled with one entry per check, SIM_MAX_CHECKS at most
+ *  @return number of checks run
+ */
+int SimRunChecks(struct SimCheckResult *results);
+
+#endif // BATTLESIM_H
@@ -0,0 +1,364 @@
+#include "../../../include/types.h"
+#include "../../../include/battle.h"
+#include "../../../include/code_addon.h"
+#include "../../../include/pokemon.h"
+#include "../../../include/constants/ability.h"
+#include "../../../include/constants/file.h"
+#include "../../../include/constants/item.h"
+#include "battlesim.h"
+#include "host_rom.h"
+
+// built in here instead of linked so the checks can see its tables and static lookups
+#include "../../../src/battle/mega.c"
+
+// equivalence checks for the lookups that replaced a table walk or a file load in src/.  each one runs the old way
+// next to the new one over every input it can take and counts the disagreements
+
+// type ids past the end of the chart, to make sure they still come back neutral
+#define CHECK_TYPES (NUM_TYPES + 2)
+
+// every value the 11-bit item, move and 5-bit form fields of the mega tables can hold, and a few species past the end
+#define CHECK_MEGA_SPECIES (MAX_MON_NUM + 8)
+#define CHECK_MEGA_ITEMS 0x800
+#define CHECK_MEGA_FORMS 0x20
+
+// the species past the last one should all come back without evolutions
+#define CHECK_EVOLUTION_SPECIES (MAX_SPECIES_INCLUDING_FORMS + 64)
+
+// times every species' entries are looked up, standing in for a session's worth of exp gains and overworld sprites
+#define CHECK_CODE_ADDON_ROUNDS 16
+
+// turns of random four battler fields the ai score matrix is checked over
+#define CHECK_AI_TURNS 2000
+
+
+/**
+ *  @brief the TypeEffectivenessTable walk ServerDoTypeCalcMod and AITypeCalc did before GetTypeEffectivenessRows
+ */
+static void OldTypeEffectivenessRows(u32 move_type, u32 type1, u32 type2, BOOL foresight, int rows[2])
+{
+    int i, found = 0;
+
+    rows[0] = rows[1] = -1;
+    for (i = 0; TypeEffectivenessTable[i][0] != 0xff; i++)
+    {
+        if (TypeEffectivenessTable[i][0] == 0xfe)
+        {
+            if (foresight)
+                break;
+            continue;
+        }
+        if (TypeEffectivenessTable[i][0] == move_type)
+        {
+            if (TypeEffectivenessTable[i][1] == type1 && found < 2)
+                rows[found++] = i;
+            if (TypeEffectivenessTable[i][1] == type2 && type1 != type2 && found < 2)
+                rows[found++] = i;
+        }
+    }
+}
+
+static void CheckTypeEffectiveness(struct SimCheckResult *result)
+{
+    u32 move_type, type1, type2;
+    int foresight, oldRows[2], newRows[2];
+
+    result->name = "type effectiveness rows";
+    for (move_type = 0; move_type < CHECK_TYPES; move_type++)
+    {
+        for (type1 = 0; type1 < CHECK_TYPES; type1++)
+        {
+            for (type2 = 0; type2 < CHECK_TYPES; type2++)
+            {
+                for (foresight = FALSE; foresight <= TRUE; foresight++)
+                {
+                    OldTypeEffectivenessRows(move_type, type1, type2, foresight, oldRows);
+                    GetTypeEffectivenessRows(move_type, type1, type2, foresight, newRows);
+                    result->cases++;
+                    if (oldRows[0] != newRows[0] || oldRows[1] != newRows[1])
+                        result->failures++;
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ *  @brief the sMegaTable and sMegaMoveTable scans mega.c did before the per species chains
+ */
+static BOOL OldIsMegaSpecies(u32 mon, u32 form)
+{
+    u32 i;
+    for (i = 0; i < NELEMS(sMegaTable); i++)
+        if (sMegaTable[i].monindex == mon && sMegaTable[i].form == form)
+            return TRUE;
+    return FALSE;
+}
+
+static BOOL OldCheckMegaData(u32 mon, u32 item)
+{
+    u32 i;
+    for (i = 0; i < NELEMS(sMegaTable); i++)
+        if (sMegaTable[i].monindex == mon && sMegaTable[i].itemindex == item)
+            return TRUE;
+    return FALSE;
+}
+
+static u32 OldGrabMegaTargetForm(u32 mon, u32 item)
+{
+    u32 i;
+    for (i = 0; i < NELEMS(sMegaTable); i++)
+        if (sMegaTable[i].monindex == mon && sMegaTable[i].itemindex == item)
+            return sMegaTable[i].form;
+    for (i = 0; i < NELEMS(sMegaMoveTable); i++)
+        if (sMegaMoveTable[i].monindex == mon)
+            return sMegaMoveTable[i].form;
+    return 0;
+}
+
+static BOOL OldCheckMegaMoveData(u32 mon, u16 *moves)
+{
+    u32 i, j;
+    for (i = 0; i < NELEMS(sMegaMoveTable); i++)
+        if (sMegaMoveTable[i].monindex == mon)
+            for (j = 0; j < 4; j++)
+                if (sMegaMoveTable[i].moveindex == moves[j])
+                    return TRUE;
+    return FALSE;
+}
+
+static BOOL OldIsMegaSpeciesByMove(u32 mon, u32 form)
+{
+    u32 i;
+    for (i = 0; i < NELEMS(sMegaMoveTable); i++)
+        if (sMegaMoveTable[i].monindex == mon && sMegaMoveTable[i].form == form)
+            return TRUE;
+    return FALSE;
+}
+
+static void CheckMegaLookups(struct SimCheckResult *result)
+{
+    u32 mon, value;
+    u16 moves[4] = { 0 };
+
+    result->name = "mega evolution lookups";
+    for (mon = 0; mon < CHECK_MEGA_SPECIES; mon++)
+    {
+        for (value = 0; value < CHECK_MEGA_ITEMS; value++)
+        {
+            // the move goes in the last slot so the check can't pass by only looking at the first one
+            moves[3] = value;
+            result->cases += 3;
+            if (CheckMegaData(mon, value) != OldCheckMegaData(mon, value))
+                result->failures++;
+            if (GrabMegaTargetForm(mon, value) != OldGrabMegaTargetForm(mon, value))
+                result->failures++;
+            if (CheckMegaMoveData(mon, moves) != OldCheckMegaMoveData(mon, moves))
+                result->failures++;
+        }
+        for (value = 0; value < CHECK_MEGA_FORMS; value++)
+        {
+            result->cases += 2;
+            if (IsMegaSpecies(mon, value) != OldIsMegaSpecies(mon, value))
+                result->failures++;
+            if (IsMegaSpeciesByMove(mon, value) != OldIsMegaSpeciesByMove(mon, value))
+                result->failures++;
+        }
+    }
+}
+
+int SimSetEvolutionFile(uint32_t species, const void *data, uint32_t size)
+{
+    if (species > MAX_SPECIES_INCLUDING_FORMS)
+        return -1;
+    return HostSetArchiveFile(ARC_EVOLUTIONS, species, data, size);
+}
+
+void SimSetEvolutionIndex(const void *data, uint32_t size)
+{
+    HostSetArchiveFile(ARC_CODE_ADDONS, CODE_ADDON_EVOLUTION_INDEX, data, size);
+}
+
+/**
+ *  @brief compare the evolution index lookups against each species' evolution file, read the way GetMonEvolution did
+ *         before the index:  every MAX_EVOS_PER_POKE entry, skipping EVO_NONE
+ */
+static void CheckEvolutionIndex(struct SimCheckResult *result)
+{
+    struct Evolution file[MAX_EVOS_PER_POKE];
+    struct Evolution *evolutions;
+    u32 species;
+    int i, count, found;
+
+    result->name = "evolution index";
+    if (!HostHasArchiveFile(ARC_CODE_ADDONS, CODE_ADDON_EVOLUTION_INDEX) || !HostHasArchiveFile(ARC_EVOLUTIONS, 0))
+    {
+        result->skipped = "no built evolution data";
+        return;
+    }
+
+    for (species = 0; species < CHECK_EVOLUTION_SPECIES; species++)
+    {
+        ArchiveDataLoadOfs(file, ARC_EVOLUTIONS, species, 0, sizeof(file));
+        evolutions = GetSpeciesEvolutions(species, &count);
+        result->cases++;
+
+        found = 0;
+        for (i = 0; i < MAX_EVOS_PER_POKE; i++)
+        {
+            if (file[i].method == EVO_NONE)
+                continue;
+            if (found >= count || evolutions[found].method != file[i].method || evolutions[found].param != file[i].param
+             || evolutions[found].target != file[i].target)
+                break;
+            found++;
+        }
+        if (i < MAX_EVOS_PER_POKE || found != count || SpeciesHasEvolutions(species) != (count != 0))
+            result->failures++;
+    }
+}
+
+/**
+ *  @brief look every entry of the resident code addon files up over and over, and make sure each file was only read
+ *         out of the archive once and comes back intact
+ */
+static void CheckCodeAddonLoads(struct SimCheckResult *result)
+{
+    static u16 baseExperience[MAX_SPECIES_INCLUDING_FORMS + 1];
+    static u8 owForms[MAX_MON_NUM + 1];
+    u32 round, species;
+
+    result->name = "code addon loads";
+    for (species = 0; species < NELEMS(baseExperience); species++)
+        baseExperience[species] = species * 7 + 1;
+    for (species = 0; species < NELEMS(owForms); species++)
+        owForms[species] = species % 5;
+    HostSetArchiveFile(ARC_CODE_ADDONS, CODE_ADDON_BASE_EXPERIENCE_LIST, baseExperience, sizeof(baseExperience));
+    HostSetArchiveFile(ARC_CODE_ADDONS, CODE_ADDON_NUM_OF_OW_FORMS_PER_MON, owForms, sizeof(owForms));
+
+    for (round = 0; round < CHECK_CODE_ADDON_ROUNDS; round++)
+    {
+        for (species = 0; species < NELEMS(baseExperience); species++)
+        {
+            result->cases++;
+            if (((u16 *)GetCodeAddonData(CODE_ADDON_BASE_EXPERIENCE_LIST))[species] != baseExperience[species])
+                result->failures++;
+        }
+        for (species = 0; species < NELEMS(owForms); species++)
+        {
+            result->cases++;
+            if (((u8 *)GetCodeAddonData(CODE_ADDON_NUM_OF_OW_FORMS_PER_MON))[species] != owForms[species])
+                result->failures++;
+        }
+    }
+
+    // a load per file, no matter how many lookups
+    result->cases += 2;
+    if (HostArchiveLoadCount(ARC_CODE_ADDONS, CODE_ADDON_BASE_EXPERIENCE_LIST) != 1)
+        result->failures++;
+    if (HostArchiveLoadCount(ARC_CODE_ADDONS, CODE_ADDON_NUM_OF_OW_FORMS_PER_MON) != 1)
+        result->failures++;
+}
+
+
+/**
+ *  @brief AITypeCalc answering from the score matrix against AITypeCalc working every answer out.  a flag that isn't 0
+ *         coming in skips the matrix, and MOVE_STATUS_FLAG_FAILED is one the type calc never touches
+ */
+static void CheckAIScoreMatrix(struct SimCheckResult *result)
+{
+    static struct BattleStruct battle;
+    static const u16 abilities[] =
+    {
+        ABILITY_NONE, ABILITY_LEVITATE, ABILITY_SCRAPPY, ABILITY_NORMALIZE, ABILITY_PIXILATE, ABILITY_AERILATE,
+        ABILITY_MOLD_BREAKER, ABILITY_WONDER_GUARD, ABILITY_LIQUID_VOICE,
+    };
+    static const u16 items[] = { ITEM_NONE, ITEM_IRON_BALL, ITEM_AIR_BALLOON, ITEM_RING_TARGET };
+    struct BattleStruct *sp = &battle;
+    u32 turn, move, types[3], cached, direct;
+    int attacker, defender, i, j, k;
+
+    result->name = "ai score matrix";
+    HostSeedRand(0x5EED);
+    for (move = 1; move <= NUM_OF_MOVES; move++)
+        sp->moveTbl[move].type = gf_rand() % NUM_TYPES;
+
+    for (turn = 1; turn <= CHECK_AI_TURNS; turn++)
+    {
+        sp->total_turn = turn;
+        sp->field_condition = (gf_rand() % 4 == 0) ? FIELD_STATUS_GRAVITY : 0;
+        for (i = 0; i < CLIENT_MAX; i++)
+        {
+            sp->battlemon[i].hp = 1;
+            sp->battlemon[i].ability = abilities[gf_rand() % NELEMS(abilities)];
+            sp->battlemon[i].item = items[gf_rand() % NELEMS(items)];
+            sp->battlemon[i].type1 = gf_rand() % NUM_TYPES;
+            sp->battlemon[i].type2 = (gf_rand() % 2) ? sp->battlemon[i].type1 : gf_rand() % NUM_TYPES;
+            sp->battlemon[i].condition2 = (gf_rand() % 2) ? STATUS2_FLAG_FORESIGHT : 0;
+            sp->battlemon[i].effect_of_moves = (gf_rand() % 2) ? MOVE_EFFECT_FLAG_MIRACLE_EYE : 0;
+            for (j = 0; j < 4; j++)
+                sp->battlemon[i].move[j] = (gf_rand() % 8 == 0) ? MOVE_NONE : 1 + gf_rand() % NUM_OF_MOVES;
+        }
+
+        // the ai goes target by target, and comes back to targets it has already looked at
+        for (i = 0; i < 3 * CLIENT_MAX * CLIENT_MAX; i++)
+        {
+            attacker = gf_rand() % CLIENT_MAX;
+            defender = gf_rand() % CLIENT_MAX;
+            if (attacker == defender)
+                continue;
+            sp->aiWorkTable.ai_attack_client = attacker;
+            sp->aiWorkTable.ai_defence_client = defender;
+            sp->current_move_index = sp->battlemon[attacker].move[gf_rand() % 4];
+            for (j = 0; j < 4; j++)
+            {
+                move = sp->battlemon[attacker].move[j];
+                if (move == MOVE_NONE)
+                    continue;
+                // left to the move data, the move's own type, and a type changed by something like hidden power
+                types[0] = 0;
+                types[1] = sp->moveTbl[move].type;
+                types[2] = gf_rand() % NUM_TYPES;
+                for (k = 0; k < (int)NELEMS(types); k++)
+                {
+                    cached = 0;
+                    direct = MOVE_STATUS_FLAG_FAILED;
+                    AITypeCalc(sp, move, types[k], GetBattlerAbility(sp, attacker),
+                               GetBattlerAbility(sp, defender), HeldItemHoldEffectGet(sp, defender),
+                               sp->battlemon[defender].type1, sp->battlemon[defender].type2, &cached);
+                    AITypeCalc(sp, move, types[k], GetBattlerAbility(sp, attacker),
+                               GetBattlerAbility(sp, defender), HeldItemHoldEffectGet(sp, defender),
+                               sp->battlemon[defender].type1, sp->battlemon[defender].type2, &direct);
+                    result->cases++;
+                    if (cached != (direct & ~MOVE_STATUS_FLAG_FAILED))
+                        result->failures++;
+                }
+            }
+        }
+        if (turn % 2)
+            AIClearScoreMatrices(sp);
+    }
+}
+
+
+int SimRunChecks(struct SimCheckResult *results)
+{
+    int count = 0;
+    u32 i;
+
+    for (i = 0; i < SIM_MAX_CHECKS; i++)
+    {
+        results[i].name = NULL;
+        results[i].cases = 0;
+        results[i].failures = 0;
+        results[i].skipped = NULL;
+    }
+
+    CheckTypeEffectiveness(&results[count++]);
+    CheckMegaLookups(&results[count++]);
+    CheckEvolutionIndex(&results[count++]);
+    CheckCodeAddonLoads(&results[count++]);
+    CheckAIScoreMatrix(&results[count++]);
+    return count;
+}
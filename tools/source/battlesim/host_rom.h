@@ -0,0 +1,58 @@
+#ifndef HOST_ROM_H
+#define HOST_ROM_H
+
+#include "../../../include/types.h"
+
+/**
+ *  @brief what the host stand-ins use in place of the battle system the arm9 routines are handed as bw
+ */
+struct HostBattleWork
+{
+    u32 battle_type;   /**< BATTLE_TYPE_* flags returned by BattleTypeGet */
+    u32 rand_state;    /**< BattleRand state */
+    int client_max;    /**< number of battlers on the field */
+};
+
+// in rom_stubs.c
+/**
+ *  @brief seed the gf_rand stand-in
+ *
+ *  @param seed new state
+ */
+void HostSeedRand(u32 seed);
+
+/**
+ *  @brief give the archive stand-ins a narc member to hand out.  the data isn't copied and has to stay around
+ *
+ *  @param arc ARC_* archive
+ *  @param file member index
+ *  @param data member contents
+ *  @param size member size
+ *  @return 0 on success, -1 if there is no room for another member
+ */
+int HostSetArchiveFile(u32 arc, u32 file, const void *data, u32 size);
+
+/**
+ *  @brief check if a narc member was handed to HostSetArchiveFile
+ *
+ *  @param arc ARC_* archive
+ *  @param file member index
+ *  @return TRUE if the archive stand-ins have the member
+ */
+BOOL HostHasArchiveFile(u32 arc, u32 file);
+
+/**
+ *  @brief count the loads of a narc member through the archive stand-ins
+ *
+ *  @param arc ARC_* archive
+ *  @param file member index
+ *  @return number of ArchiveDataLoad and ArchiveDataLoadOfs calls for the member so far
+ */
+u32 HostArchiveLoadCount(u32 arc, u32 file);
+
+/**
+ *  @brief number of entries in the item data table linked into the host build
+ */
+extern const u32 gHostItemDataCount;
+
+#endif // HOST_ROM_H
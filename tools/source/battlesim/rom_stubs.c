@@ -0,0 +1,688 @@
+#include "../../../include/types.h"
+#include "../../../include/battle.h"
+#include "../../../include/item.h"
+#include "../../../include/pokemon.h"
+#include "../../../include/constants/ability.h"
+#include "../../../include/constants/hold_item_effects.h"
+#include "host_rom.h"
+
+// the item data the rom builds into a/0/1/7, linked straight in so held items behave the same as in game.  the ability
+// patch's price doesn't fit its u16 and is cut to 53392, in the rom build as well, so that warning is left to the rom
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Woverflow"
+#include "../../../data/itemdata/itemdata.c"
+#pragma GCC diagnostic pop
+
+const u32 gHostItemDataCount = NELEMS(__data);
+
+// host stand-ins for the arm9 routines the battle code calls into.  the ones the damage, speed and critical hit
+// calculators depend on follow what the rom does for a single battle.  the rest only exist so the battle sources link
+// and do nothing:  no messages, records, party data or battle scripts are involved in the simulator
+
+struct newBattleStruct newBS;
+
+static u32 sRandState;
+
+
+/********************************* system *********************************/
+
+void GF_ASSERT(u32 cond UNUSED)
+{
+}
+
+void HostSeedRand(u32 seed)
+{
+    sRandState = seed;
+}
+
+u16 gf_rand(void)
+{
+    sRandState = sRandState * 1103515245 + 24691;
+    return sRandState >> 16;
+}
+
+void sys_FreeMemoryEz(void *ptr UNUSED)
+{
+}
+
+
+/********************************* file system *********************************/
+
+// narc members the driver loaded from the build directory, for the code that reads archives
+#define HOST_MAX_ARCHIVE_FILES 2048
+
+struct HostArchiveFile
+{
+    u32 arc;
+    u32 file;
+    const u8 *data;
+    u32 size;
+    u32 loads;
+};
+
+static struct HostArchiveFile sArchiveFiles[HOST_MAX_ARCHIVE_FILES];
+static u32 sArchiveFileCount;
+
+static const struct HostArchiveFile *FindArchiveFile(u32 arc, u32 file)
+{
+    u32 i;
+
+    for (i = 0; i < sArchiveFileCount; i++)
+    {
+        if (sArchiveFiles[i].arc == arc && sArchiveFiles[i].file == file)
+            return &sArchiveFiles[i];
+    }
+    return NULL;
+}
+
+int HostSetArchiveFile(u32 arc, u32 file, const void *data, u32 size)
+{
+    struct HostArchiveFile *member = (struct HostArchiveFile *)FindArchiveFile(arc, file);
+
+    if (member == NULL)
+    {
+        if (sArchiveFileCount >= HOST_MAX_ARCHIVE_FILES)
+            return -1;
+        member = &sArchiveFiles[sArchiveFileCount++];
+    }
+    member->arc = arc;
+    member->file = file;
+    member->data = data;
+    member->size = size;
+    member->loads = 0;
+    return 0;
+}
+
+BOOL HostHasArchiveFile(u32 arc, u32 file)
+{
+    return FindArchiveFile(arc, file) != NULL;
+}
+
+u32 HostArchiveLoadCount(u32 arc, u32 file)
+{
+    const struct HostArchiveFile *member = FindArchiveFile(arc, file);
+
+    return (member != NULL) ? member->loads : 0;
+}
+
+// a member that was never handed over reads as zeroes, as does anything past the end of one
+void ArchiveDataLoadOfs(void *data, int arcID, int datID, int ofs, int size)
+{
+    struct HostArchiveFile *member = (struct HostArchiveFile *)FindArchiveFile(arcID, datID);
+    u8 *dest = data;
+    int i;
+
+    for (i = 0; i < size; i++)
+    {
+        dest[i] = (member != NULL && (u32)(ofs + i) < member->size) ? member->data[ofs + i] : 0;
+    }
+    if (member != NULL)
+        member->loads++;
+}
+
+void ArchiveDataLoad(void *data, int arcID, int datID)
+{
+    const struct HostArchiveFile *member = FindArchiveFile(arcID, datID);
+
+    if (member != NULL)
+        ArchiveDataLoadOfs(data, arcID, datID, 0, member->size);
+}
+
+
+/********************************* battle system *********************************/
+
+u16 BattleRand(void *bw)
+{
+    struct HostBattleWork *work = bw;
+
+    work->rand_state = work->rand_state * 1103515245 + 24691;
+    return work->rand_state >> 16;
+}
+
+u32 BattleTypeGet(void *bw)
+{
+    return ((struct HostBattleWork *)bw)->battle_type;
+}
+
+int BattleWorkClientSetMaxGet(void *bw)
+{
+    return ((struct HostBattleWork *)bw)->client_max;
+}
+
+u8 IsClientEnemy(void *bw UNUSED, int client)
+{
+    return client & 1;
+}
+
+int BattleWorkPartnerClientNoGet(void *bw UNUSED, int client_no)
+{
+    return BATTLER_ALLY(client_no);
+}
+
+int BattleWorkEnemyClientGet(void *bw UNUSED, int client, int side UNUSED)
+{
+    return BATTLER_OPPONENT(client);
+}
+
+int BattleWorkClientNoGet(void *bw UNUSED, int client_type)
+{
+    return client_type;
+}
+
+u32 ST_ServerDir2ClientNoGet(void *bw UNUSED, struct BattleStruct *sp UNUSED, u32 side)
+{
+    return side;
+}
+
+/**
+ *  @brief only the turn counter (3) is ever asked for by the calculators
+ */
+int BattleWorkMonDataGet(void *bw UNUSED, void *sp, int id, int client UNUSED)
+{
+    return (id == 3) ? ((struct BattleStruct *)sp)->total_turn : 0;
+}
+
+int BattleWorkWeatherGet(void *bw UNUSED)
+{
+    return 0;
+}
+
+u32 BattleWorkBattleStatusFlagGet(void *bw UNUSED)
+{
+    return 0;
+}
+
+u16 BattleWorkCommIDGet(void *bw UNUSED)
+{
+    return 0;
+}
+
+int BattleWorkCommStandNoGet(void *bw UNUSED, u16 id UNUSED)
+{
+    return 0;
+}
+
+int BattleWorkPokeCountGet(void *bw UNUSED, int client UNUSED)
+{
+    return 1;
+}
+
+struct Party *BattleWorkPokePartyGet(void *bw UNUSED, int client_no UNUSED)
+{
+    return NULL;
+}
+
+struct PartyPokemon *BattleWorkPokemonParamGet(void *bw UNUSED, int client_no UNUSED, int sel_mons_no UNUSED)
+{
+    return NULL;
+}
+
+struct PartyPokemon *PokeParty_GetMemberPointer(struct Party *party UNUSED, int pos UNUSED)
+{
+    return NULL;
+}
+
+
+/********************************* battlers *********************************/
+
+int BattlePokemonParamGet(void *bsp, int client, int id, void *buf UNUSED)
+{
+    struct BattlePokemon *mon = &((struct BattleStruct *)bsp)->battlemon[client];
+
+    switch (id)
+    {
+    case BATTLE_MON_DATA_SPECIES:
+        return mon->species;
+    case BATTLE_MON_DATA_ATK:
+        return mon->attack;
+    case BATTLE_MON_DATA_DEF:
+        return mon->defense;
+    case BATTLE_MON_DATA_SPE:
+        return mon->speed;
+    case BATTLE_MON_DATA_SPATK:
+        return mon->spatk;
+    case BATTLE_MON_DATA_SPDEF:
+        return mon->spdef;
+    case BATTLE_MON_DATA_MOVE_1:
+    case BATTLE_MON_DATA_MOVE_2:
+    case BATTLE_MON_DATA_MOVE_3:
+    case BATTLE_MON_DATA_MOVE_4:
+        return mon->move[id - BATTLE_MON_DATA_MOVE_1];
+    case BATTLE_MON_DATA_STATE_HP:
+    case BATTLE_MON_DATA_STATE_ATK:
+    case BATTLE_MON_DATA_STATE_DEF:
+    case BATTLE_MON_DATA_STATE_SPE:
+    case BATTLE_MON_DATA_STATE_SPATK:
+    case BATTLE_MON_DATA_STATE_SPDEF:
+    case BATTLE_MON_DATA_STATE_ACCURACY:
+    case BATTLE_MON_DATA_STATE_EVASIVENESS:
+        return mon->states[id - BATTLE_MON_DATA_STATE_HP];
+    case BATTLE_MON_DATA_ABILITY:
+        return mon->ability;
+    case BATTLE_MON_DATA_TYPE1:
+        return mon->type1;
+    case BATTLE_MON_DATA_TYPE2:
+        return mon->type2;
+    case BATTLE_MON_DATA_SEX:
+        return mon->sex;
+    case BATTLE_MON_DATA_LEVEL:
+        return mon->level;
+    case BATTLE_MON_DATA_HP:
+        return mon->hp;
+    case BATTLE_MON_DATA_MAX_HP:
+        return mon->maxhp;
+    case BATTLE_MON_DATA_MAX_CONDITION:
+        return mon->condition;
+    case BATTLE_MON_DATA_STATUS2:
+        return mon->condition2;
+    case BATTLE_MON_HELD_ITEM:
+        return mon->item;
+    case BATTLE_MON_DATA_MOVE_STATE:
+        return mon->effect_of_moves;
+    case BATTLE_MON_FLASH_FIRE_ACTIVATED:
+        return mon->moveeffect.flashFire;
+    case BATTLE_MON_DATA_SLOW_START_COUNTER:
+        return mon->moveeffect.slowStartTurns;
+    }
+    return 0;
+}
+
+int GetBattlerAbility(struct BattleStruct *sp, int client)
+{
+    if (sp->battlemon[client].effect_of_moves & MOVE_EFFECT_GASTRO_ACID)
+    {
+        return ABILITY_NONE;
+    }
+    return sp->battlemon[client].ability;
+}
+
+/**
+ *  @brief count the battlers with an ability.  only the counting modes are supported, the others return 0
+ */
+int CheckSideAbility(void *bw, struct BattleStruct *sp, int flag, int client_no, int speabi)
+{
+    int i, count = 0;
+
+    for (i = 0; i < BattleWorkClientSetMaxGet(bw); i++)
+    {
+        if (GetBattlerAbility(sp, i) != speabi)
+        {
+            continue;
+        }
+        switch (flag)
+        {
+        case CHECK_PLAYER_SIDE_ALL:
+        case CHECK_PLAYER_SIDE_ALIVE:
+            if (IsClientEnemy(bw, i) == IsClientEnemy(bw, client_no)
+             && (flag == CHECK_PLAYER_SIDE_ALL || sp->battlemon[i].hp))
+            {
+                count++;
+            }
+            break;
+        case CHECK_ENEMY_SIDE_ALL:
+        case CHECK_ENEMY_SIDE_ALIVE:
+            if (IsClientEnemy(bw, i) != IsClientEnemy(bw, client_no)
+             && (flag == CHECK_ENEMY_SIDE_ALL || sp->battlemon[i].hp))
+            {
+                count++;
+            }
+            break;
+        case CHECK_ALL_BATTLER_ALIVE:
+            if (sp->battlemon[i].hp)
+            {
+                count++;
+            }
+            break;
+        }
+    }
+    return count;
+}
+
+u8 CheckNumMonsHit(void *bw UNUSED, void *sp UNUSED, int flag UNUSED, int client UNUSED)
+{
+    return 1;
+}
+
+BOOL CheckFieldMoveEffect(void *bw UNUSED, void *sp UNUSED, int flag UNUSED)
+{
+    return FALSE;
+}
+
+u32 CheckSubstitute(struct BattleStruct *sp, int client_no)
+{
+    return (sp->battlemon[client_no].condition2 & STATUS2_FLAG_SUBSTITUTE) != 0;
+}
+
+int GetBattlePokemonMovePosFromMove(struct BattlePokemon *battlemon, u16 move)
+{
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        if (battlemon->move[i] == move)
+        {
+            return i;
+        }
+    }
+    return 4;
+}
+
+int CountBattlerMoves(void *bw UNUSED, struct BattleStruct *sp, int client_no)
+{
+    int i, count = 0;
+
+    for (i = 0; i < 4; i++)
+    {
+        count += (sp->battlemon[client_no].move[i] != 0);
+    }
+    return count;
+}
+
+u32 IsMovingAfterClient(struct BattleStruct *sp UNUSED, int client_no UNUSED)
+{
+    return FALSE;
+}
+
+int ChooseRandomTarget(void *bw UNUSED, struct BattleStruct *sp UNUSED, int client)
+{
+    return BATTLER_OPPONENT(client);
+}
+
+int TraceClientGet(void *bw UNUSED, struct BattleStruct *sp UNUSED, int def1, int def2 UNUSED)
+{
+    return def1;
+}
+
+
+/********************************* items *********************************/
+
+s32 BattleItemDataGet(void *sp UNUSED, u16 item, u16 param)
+{
+    if (item >= gHostItemDataCount)
+    {
+        return 0;
+    }
+    switch (param)
+    {
+    case ITEM_PARAM_HOLD_EFFECT:
+        return __data[item].holdEffect;
+    case ITEM_PARAM_ATTACK:
+        return __data[item].holdEffectParam;
+    }
+    return 0;
+}
+
+int HeldItemHoldEffectGet(struct BattleStruct *sp, int client_no)
+{
+    return BattleItemDataGet(sp, GetBattleMonItem(sp, client_no), ITEM_PARAM_HOLD_EFFECT);
+}
+
+int HeldItemAtkGet(struct BattleStruct *sp, int client_no, int flag)
+{
+    return BattleItemDataGet(sp, (flag == ATK_CHECK_NONE) ? sp->battlemon[client_no].item : GetBattleMonItem(sp, client_no), ITEM_PARAM_ATTACK);
+}
+
+u8 GetArceusType(u16 held_effect UNUSED)
+{
+    return TYPE_NORMAL;
+}
+
+u32 GetGenesectForme(u16 item UNUSED)
+{
+    return 0;
+}
+
+BOOL HeldItemEffectCheck(void *bw UNUSED, struct BattleStruct *sp UNUSED, int client_no UNUSED)
+{
+    return FALSE;
+}
+
+u32 HeldItemHealCheck(void *bw UNUSED, struct BattleStruct *sp UNUSED, int client_no UNUSED, int *seq_no UNUSED)
+{
+    return FALSE;
+}
+
+BOOL HeldItemHealStatusCheck(void *bw UNUSED, struct BattleStruct *sp UNUSED, int client_no UNUSED, int *seq_no UNUSED)
+{
+    return FALSE;
+}
+
+
+/********************************* type effectiveness *********************************/
+
+int BattleDamageDivide(int data, int divisor)
+{
+    int ret = data / divisor;
+
+    if (ret == 0 && data > 0)
+    {
+        return 1;
+    }
+    if (ret == 0 && data < 0)
+    {
+        return -1;
+    }
+    return ret;
+}
+
+/**
+ *  @brief apply one row of the type chart to the damage and mark the move status flags accordingly
+ */
+int TypeCheckCalc(struct BattleStruct *sp UNUSED, u32 attack_client UNUSED, u32 typeModifier, int damage, int base_power, u32 *flag)
+{
+    switch (typeModifier)
+    {
+    case 0:
+        flag[0] |= MOVE_STATUS_FLAG_NOT_EFFECTIVE;
+        flag[0] &= ~(MOVE_STATUS_FLAG_SUPER_EFFECTIVE | MOVE_STATUS_FLAG_NOT_VERY_EFFECTIVE);
+        break;
+    case 5:
+        if (base_power)
+        {
+            if (flag[0] & MOVE_STATUS_FLAG_SUPER_EFFECTIVE)
+            {
+                flag[0] &= ~MOVE_STATUS_FLAG_SUPER_EFFECTIVE;
+            }
+            else
+            {
+                flag[0] |= MOVE_STATUS_FLAG_NOT_VERY_EFFECTIVE;
+            }
+        }
+        break;
+    case 20:
+        if (base_power)
+        {
+            if (flag[0] & MOVE_STATUS_FLAG_NOT_VERY_EFFECTIVE)
+            {
+                flag[0] &= ~MOVE_STATUS_FLAG_NOT_VERY_EFFECTIVE;
+            }
+            else
+            {
+                flag[0] |= MOVE_STATUS_FLAG_SUPER_EFFECTIVE;
+            }
+        }
+        break;
+    }
+    return damage * typeModifier / 10;
+}
+
+int AI_TypeCheckCalc(int effectiveness, u32 *flag)
+{
+    return TypeCheckCalc(NULL, 0, effectiveness, 40, 40, flag);
+}
+
+BOOL ShouldUseNormalTypeEffCalc(struct BattleStruct *sp UNUSED, int attack_client UNUSED, int defence_client UNUSED, int pos UNUSED)
+{
+    return TRUE;
+}
+
+// the rom reads the battler the ai is looking at out of sp, here foresight and miracle eye on it let moves through its
+// ghost and dark immunities
+BOOL AI_ShouldUseNormalTypeEffCalc(struct BattleStruct *sp, u32 held_effect UNUSED, int pos)
+{
+    struct BattlePokemon *defender = &sp->battlemon[sp->aiWorkTable.ai_defence_client];
+
+    if (TypeEffectivenessTable[pos][2] != 0)
+    {
+        return TRUE;
+    }
+    if (TypeEffectivenessTable[pos][1] == TYPE_GHOST && (defender->condition2 & STATUS2_FLAG_FORESIGHT))
+    {
+        return FALSE;
+    }
+    if (TypeEffectivenessTable[pos][1] == TYPE_DARK && (defender->effect_of_moves & MOVE_EFFECT_FLAG_MIRACLE_EYE))
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+BOOL ShouldDelayTurnEffectivenessChecking(struct BattleStruct *sp UNUSED, u32 move_no UNUSED)
+{
+    return TRUE;
+}
+
+int TypeCalc(void *bw, struct BattleStruct *sp, int movenum, int movetype, int attacker, int defender, int damage, u32 *flag)
+{
+    return ServerDoTypeCalcMod(bw, sp, movenum, movetype, attacker, defender, damage, flag);
+}
+
+u32 AnticipateMoveEffectListCheck(struct BattleStruct *sp UNUSED, int movenum UNUSED)
+{
+    return FALSE;
+}
+
+
+/********************************* battle flow *********************************/
+
+// nothing below runs in the simulator.  the server side of a turn is driven by battle scripts, which stay in the rom
+
+u32 AbilityStatusRecoverCheck(void *bw UNUSED, struct BattleStruct *sp UNUSED, int client_no UNUSED, int act_flag UNUSED)
+{
+    return FALSE;
+}
+
+int CheckIfAnyoneShouldFaint(struct BattleStruct *sp UNUSED, int next_seq UNUSED, int no_set_seq UNUSED, int flag UNUSED)
+{
+    return FALSE;
+}
+
+void CheckPressureForPPDecrease(struct BattleStruct *sp UNUSED, int attack UNUSED, int defence UNUSED)
+{
+}
+
+int GrabClientFromBattleScriptParam(void *bw UNUSED, struct BattleStruct *sp UNUSED, int side UNUSED)
+{
+    return 0;
+}
+
+void LoadBattleSubSeqScript(struct BattleStruct *sp UNUSED, int kind UNUSED, int index UNUSED)
+{
+}
+
+BOOL ST_ServerAddStatusCheck(void *bw UNUSED, void *sp UNUSED, int *seq_no UNUSED)
+{
+    return FALSE;
+}
+
+int ST_ServerPokeAppearCheck(void *bw UNUSED, struct BattleStruct *sp UNUSED)
+{
+    return FALSE;
+}
+
+BOOL ServerCriticalMessage(void *bw UNUSED, void *sp UNUSED)
+{
+    return FALSE;
+}
+
+BOOL ServerGetExpCheck(struct BattleStruct *sp UNUSED, u32 seq UNUSED, u32 seq2 UNUSED)
+{
+    return FALSE;
+}
+
+BOOL ServerIkariCheck(void *bw UNUSED, void *sp UNUSED)
+{
+    return FALSE;
+}
+
+BOOL ServerWazaStatusMessage(void *bw UNUSED, void *sp UNUSED)
+{
+    return FALSE;
+}
+
+BOOL ServerZenmetsuCheck(void *bw UNUSED, struct BattleStruct *sp UNUSED)
+{
+    return FALSE;
+}
+
+void SCIO_BlankMessage(void *bw UNUSED)
+{
+}
+
+void SCIO_IncRecord(void *bw UNUSED, int attack_client UNUSED, int param1 UNUSED, int param2 UNUSED)
+{
+}
+
+void SCIO_PSPtoPPCopy(void *bw UNUSED, struct BattleStruct *sp UNUSED, int send_client UNUSED)
+{
+}
+
+void ClientCommandReset(struct CLIENT_PARAM *cp UNUSED)
+{
+}
+
+void CT_PokemonAppearSet(void *bw UNUSED, struct CLIENT_PARAM *cp UNUSED, struct POKEMON_APPEAR_PARAM *pap UNUSED)
+{
+}
+
+void CT_PokemonEncountAppearSet(void *bw UNUSED, struct CLIENT_PARAM *cp UNUSED, struct POKEMON_APPEAR_PARAM *pap UNUSED)
+{
+}
+
+void CT_PokemonEncountSet(void *bw UNUSED, struct CLIENT_PARAM *cp UNUSED, struct POKEMON_ENCOUNT_PARAM *pep UNUSED)
+{
+}
+
+
+/********************************* party pokemon *********************************/
+
+struct PartyPokemon *AllocMonZeroed(u32 heapid UNUSED)
+{
+    return NULL;
+}
+
+u32 GetMonData(struct PartyPokemon *mon UNUSED, int field UNUSED, void *buffer UNUSED)
+{
+    return 0;
+}
+
+void SetMonData(struct PartyPokemon *mon UNUSED, int field UNUSED, void *buffer UNUSED)
+{
+}
+
+BOOL MonIsShiny(struct PartyPokemon *pokemon UNUSED)
+{
+    return FALSE;
+}
+
+void PokeCopyPPtoPP(struct PartyPokemon *pp_src UNUSED, struct PartyPokemon *pp_dest UNUSED)
+{
+}
+
+int PokeParaGiratinaFormChange(struct PartyPokemon *pp UNUSED)
+{
+    return FALSE;
+}
+
+void RecalcPartyPokemonStats(struct PartyPokemon *pp UNUSED)
+{
+}
+
+void ResetPartyPokemonAbility(void *pp UNUSED)
+{
+}
+
+bool8 RevertFormChange(struct PartyPokemon *pp UNUSED, u16 species UNUSED, u8 form_no UNUSED)
+{
+    return FALSE;
+}
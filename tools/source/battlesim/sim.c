@@ -0,0 +1,305 @@
+#include "../../../include/types.h"
+#include "../../../include/battle.h"
+#include "../../../include/constants/ability.h"
+#include "../../../include/constants/species.h"
+#include "battlesim.h"
+#include "host_rom.h"
+
+// highest ability id random battlers are drawn from
+#define SIM_LAST_ABILITY ABILITY_MYCELIUM_MIGHT
+
+// one battle per process, the driver forks for more
+static struct BattleStruct sBattle;
+static struct HostBattleWork sBattleWork;
+
+static struct BattleMove sMoveData[NUM_OF_MOVES + 1];
+static u16 sDamagingMoves[NUM_OF_MOVES + 1];
+static u32 sNumDamagingMoves;
+
+static u32 sSimRandState;
+
+static const struct
+{
+    const char *name;
+    int type;
+} sTypeNames[] =
+{
+    { "normal",   TYPE_NORMAL   },
+    { "fighting", TYPE_FIGHTING },
+    { "flying",   TYPE_FLYING   },
+    { "poison",   TYPE_POISON   },
+    { "ground",   TYPE_GROUND   },
+    { "rock",     TYPE_ROCK     },
+    { "bug",      TYPE_BUG      },
+    { "ghost",    TYPE_GHOST    },
+    { "steel",    TYPE_STEEL    },
+    { "fairy",    TYPE_FAIRY    },
+    { "fire",     TYPE_FIRE     },
+    { "water",    TYPE_WATER    },
+    { "grass",    TYPE_GRASS    },
+    { "electric", TYPE_ELECTRIC },
+    { "psychic",  TYPE_PSYCHIC  },
+    { "ice",      TYPE_ICE      },
+    { "dragon",   TYPE_DRAGON   },
+    { "dark",     TYPE_DARK     },
+};
+
+static const struct
+{
+    const char *name;
+    u32 weather;
+} sWeatherNames[] =
+{
+    { "rain", WEATHER_RAIN      },
+    { "sand", WEATHER_SANDSTORM },
+    { "sun",  WEATHER_SUNNY     },
+    { "hail", WEATHER_HAIL      },
+    { "fog",  FIELD_STATUS_FOG  },
+};
+
+
+static BOOL NamesMatch(const char *a, const char *b)
+{
+    while (*a && *a == *b)
+    {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+/**
+ *  @brief the simulator's own random numbers, kept apart from BattleRand so the battle rolls don't depend on how
+ *         battlers are drawn
+ */
+static u32 SimRand(void)
+{
+    sSimRandState ^= sSimRandState << 13;
+    sSimRandState ^= sSimRandState >> 17;
+    sSimRandState ^= sSimRandState << 5;
+    return sSimRandState;
+}
+
+/**
+ *  @brief splitmix64 finalizer, used to derive a turn's seed and its checksum term
+ */
+static u64 SimMix(u64 x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return x;
+}
+
+static u32 SimRandRange(u32 min, u32 max)
+{
+    return min + SimRand() % (max - min + 1);
+}
+
+int SimSetMoveData(uint32_t move, const void *data, uint32_t size)
+{
+    const u8 *src = data;
+    u8 *dest;
+    u32 i;
+
+    if (move > NUM_OF_MOVES)
+        return -1;
+
+    dest = (u8 *)&sMoveData[move];
+    for (i = 0; i < sizeof(struct BattleMove); i++)
+    {
+        dest[i] = (i < size) ? src[i] : 0;
+    }
+    return 0;
+}
+
+void SimUseSyntheticMoves(uint32_t seed)
+{
+    u32 i;
+
+    sSimRandState = seed | 1;
+    for (i = 1; i <= NUM_OF_MOVES; i++)
+    {
+        sMoveData[i].split = SimRandRange(SPLIT_PHYSICAL, SPLIT_SPECIAL);
+        sMoveData[i].power = SimRandRange(20, 150);
+        sMoveData[i].type = sTypeNames[SimRandRange(0, NELEMS(sTypeNames) - 1)].type;
+        sMoveData[i].accuracy = 100;
+        sMoveData[i].pp = 10;
+    }
+}
+
+int SimTypeFromName(const char *name)
+{
+    u32 i;
+
+    for (i = 0; i < NELEMS(sTypeNames); i++)
+    {
+        if (NamesMatch(name, sTypeNames[i].name))
+            return sTypeNames[i].type;
+    }
+    return -1;
+}
+
+uint32_t SimWeatherFromName(const char *name)
+{
+    u32 i;
+
+    for (i = 0; i < NELEMS(sWeatherNames); i++)
+    {
+        if (NamesMatch(name, sWeatherNames[i].name))
+            return sWeatherNames[i].weather;
+    }
+    return 0;
+}
+
+/**
+ *  @brief draw a random battler with a random damaging move
+ */
+static void RandomBattler(struct SimBattler *battler)
+{
+    battler->species = SimRandRange(1, MAX_MON_NUM);
+    battler->level = SimRandRange(1, 100);
+    battler->maxhp = SimRandRange(battler->level + 10, battler->level * 4 + 10);
+    battler->hp = SimRandRange(1, battler->maxhp);
+    battler->attack = SimRandRange(5, 400);
+    battler->defense = SimRandRange(5, 400);
+    battler->speed = SimRandRange(5, 400);
+    battler->spatk = SimRandRange(5, 400);
+    battler->spdef = SimRandRange(5, 400);
+    battler->type1 = sTypeNames[SimRandRange(0, NELEMS(sTypeNames) - 1)].type;
+    battler->type2 = (SimRand() & 1) ? battler->type1 : sTypeNames[SimRandRange(0, NELEMS(sTypeNames) - 1)].type;
+    battler->ability = SimRandRange(ABILITY_NONE, SIM_LAST_ABILITY);
+    battler->item = (SimRand() & 1) ? SimRandRange(0, gHostItemDataCount - 1) : 0;
+    battler->move = sNumDamagingMoves ? sDamagingMoves[SimRand() % sNumDamagingMoves] : 0;
+    battler->sex = SimRandRange(0, 2);
+    battler->condition = 0;
+}
+
+/**
+ *  @brief put a battler in a battlemon slot the way it would look on its first turn out
+ */
+static void LoadBattler(struct BattleStruct *sp, int client, const struct SimBattler *battler)
+{
+    struct BattlePokemon *mon = &sp->battlemon[client];
+    u32 i;
+    u8 *raw = (u8 *)mon;
+
+    for (i = 0; i < sizeof(*mon); i++)
+    {
+        raw[i] = 0;
+    }
+
+    mon->species = battler->species;
+    mon->level = battler->level;
+    mon->hp = battler->hp;
+    mon->maxhp = battler->maxhp;
+    mon->attack = battler->attack;
+    mon->defense = battler->defense;
+    mon->speed = battler->speed;
+    mon->spatk = battler->spatk;
+    mon->spdef = battler->spdef;
+    mon->type1 = battler->type1;
+    mon->type2 = battler->type2;
+    mon->ability = battler->ability;
+    mon->item = battler->item;
+    mon->move[0] = battler->move;
+    mon->pp[0] = 10;
+    mon->sex = battler->sex;
+    mon->condition = battler->condition;
+    for (i = 0; i < NELEMS(mon->states); i++)
+    {
+        mon->states[i] = 6;
+    }
+
+    sp->client_act_work[client][3] = SELECT_FIGHT_COMMAND;
+    sp->waza_no_pos[client] = 0;
+    sp->agi_rand[client] = SimRand();
+}
+
+void SimRun(const struct SimConfig *config, struct SimStats *stats)
+{
+    struct BattleStruct *sp = &sBattle;
+    struct SimBattler battler[2];
+    u32 i, flag, move, first, turnSeed;
+    u64 turn, result;
+    int damage;
+
+    for (i = 1, sNumDamagingMoves = 0; i <= NUM_OF_MOVES; i++)
+    {
+        if (sMoveData[i].power > 1 && sMoveData[i].split != SPLIT_STATUS)
+        {
+            sDamagingMoves[sNumDamagingMoves++] = i;
+        }
+    }
+
+    sBattleWork.battle_type = 0;
+    sBattleWork.client_max = 2;
+
+    for (i = 0; i < NELEMS(sp->moveTbl); i++)
+    {
+        sp->moveTbl[i] = sMoveData[i];
+    }
+    sp->field_condition = config->field_condition;
+    sp->attack_client = 0;
+    sp->defence_client = 1;
+
+    stats->turns = 0;
+    stats->attacker_first = 0;
+    stats->criticals = 0;
+    stats->knockouts = 0;
+    stats->damage_sum = 0;
+    stats->damage_min = 0xFFFFFFFF;
+    stats->damage_max = 0;
+    stats->checksum = 0;
+
+    battler[0] = config->battler[0];
+    battler[1] = config->battler[1];
+    for (turn = config->first_turn; turn < config->first_turn + config->turns; turn++)
+    {
+        // every turn starts from its own seed, so a turn plays out the same whichever job runs it
+        turnSeed = (u32)SimMix(((u64)config->seed << 32) | (turn & 0xFFFFFFFF)) ^ (u32)(turn >> 32);
+        sSimRandState = turnSeed | 1;
+        HostSeedRand(turnSeed);
+        sBattleWork.rand_state = turnSeed;
+        if (config->random_battlers)
+        {
+            RandomBattler(&battler[0]);
+            RandomBattler(&battler[1]);
+        }
+        LoadBattler(sp, 0, &battler[0]);
+        LoadBattler(sp, 1, &battler[1]);
+
+        move = battler[0].move;
+        sp->current_move_index = move;
+        sp->damage_power = 0; // 0 takes the power from the move table
+        sp->damage_value = 10;
+        sp->server_status_flag = 0;
+        sp->waza_status_flag = 0;
+
+        first = (CalcSpeed(&sBattleWork, sp, 0, 1, 0) == 0);
+        sp->critical = CalcCritical(&sBattleWork, sp, 0, 1, 0, sp->side_condition[IsClientEnemy(&sBattleWork, 1)]);
+        CalcDamageOverall(&sBattleWork, sp);
+
+        flag = 0;
+        damage = ServerDoTypeCalcMod(&sBattleWork, sp, move, sp->moveTbl[move].type, 0, 1, sp->damage, &flag);
+        damage = AdjustDamageForRoll(&sBattleWork, sp, damage);
+        if ((flag & WAZA_STATUS_FLAG_HAZURE) || damage < 0)
+        {
+            damage = 0;
+        }
+
+        stats->turns++;
+        stats->attacker_first += first;
+        stats->criticals += (sp->critical > 1);
+        stats->knockouts += (damage >= sp->battlemon[1].hp);
+        stats->damage_sum += damage;
+        if ((u32)damage < stats->damage_min)
+            stats->damage_min = damage;
+        if ((u32)damage > stats->damage_max)
+            stats->damage_max = damage;
+        result = ((u64)damage << 2) + (first << 1) + (sp->critical > 1);
+        stats->checksum += SimMix(SimMix(turn) ^ result);
+    }
+}
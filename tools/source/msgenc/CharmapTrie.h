@@ -0,0 +1,52 @@
+#ifndef GUARD_CHARMAPTRIE_H
+#define GUARD_CHARMAPTRIE_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+// Byte trie over the character sequences of a charmap. Each input byte is one
+// table lookup, so matching a character never builds temporary substrings.
+class CharmapTrie
+{
+    struct Node {
+        uint32_t next[256] = {}; // 0 means no edge, the root is never a child
+        int32_t value = -1;      // -1 if no character ends at this node
+    };
+    vector<Node> nodes;
+
+public:
+    CharmapTrie() : nodes(1) {}
+
+    void Insert(const string& code, uint16_t value) {
+        uint32_t node = 0;
+        for (unsigned char c : code) {
+            if (nodes[node].next[c] == 0) {
+                nodes[node].next[c] = nodes.size();
+                nodes.emplace_back();
+            }
+            node = nodes[node].next[c];
+        }
+        nodes[node].value = value;
+    }
+
+    // Returns the length of the shortest character at text[pos], or 0 if none
+    // matches. The shortest match is what the previous substring search found.
+    size_t Match(const string& text, size_t pos, uint16_t& value) const {
+        uint32_t node = 0;
+        for (size_t k = pos; k < text.size(); k++) {
+            node = nodes[node].next[(unsigned char)text[k]];
+            if (node == 0)
+                return 0;
+            if (nodes[node].value >= 0) {
+                value = nodes[node].value;
+                return k - pos + 1;
+            }
+        }
+        return 0;
+    }
+};
+
+#endif //GUARD_CHARMAPTRIE_H
@@ -32,31 +32,25 @@ void MessagesConverter::WriteTextFile(string& filename, string const& contents)
 
 void MessagesConverter::ReadCharmap() {
     string raw = ReadTextFile(charmapfilename);
-    string line;
-    size_t pos, eqpos, last_pos, lineno = 0;
+    string_view rest(raw);
+    size_t pos, eqpos, lineno = 0;
 
-    for (
-        last_pos = 0;
-        last_pos != string::npos && (pos = raw.find_first_of("\r\n", last_pos)) != string::npos;
-        last_pos = raw.find_last_of("\r\n", pos + 1, 2) + 1, lineno++
-    ) {
-        line = raw.substr(last_pos, pos - last_pos);
-        if (line.find("//") != string::npos) {
-            line = line.substr(0, line.find("//"));
-        }
-        if (line.find_first_not_of(" \t") == string::npos)
+    // Only lines terminated by a line break are read, as before.
+    for (; (pos = rest.find_first_of("\r\n")) != string_view::npos; lineno++) {
+        string_view line = rest.substr(0, pos);
+        rest.remove_prefix(rest.find_last_of("\r\n", pos + 1) + 1);
+        line = line.substr(0, line.find("//"));
+        if (line.find_first_not_of(" \t") == string_view::npos)
             continue;
-        line = line.substr(
-            line.find_first_not_of(" \t")
-        );
+        line.remove_prefix(line.find_first_not_of(" \t"));
         eqpos = line.find('=');
-        if (eqpos == string::npos) {
+        if (eqpos == string_view::npos) {
             stringstream s;
             s << "charmap syntax error at " << (lineno + 1);
             throw runtime_error(s.str());
         }
-        string value = line.substr(0, eqpos);
-        string code = line.substr(eqpos + 1);
+        string value(line.substr(0, eqpos));
+        string code(line.substr(eqpos + 1));
         uint16_t value_i = stoi(value, nullptr, 16);
         if (code[0] == '{' && code[code.length() - 1] == '}') {
             code = code.substr(1, code.length() - 2);
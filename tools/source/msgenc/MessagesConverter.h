@@ -3,6 +3,7 @@
 
 #include "util.h"
 #include <string>
+#include <string_view>
 #include <fstream>
 #include <map>
 #include <sstream>
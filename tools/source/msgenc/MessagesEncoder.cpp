@@ -2,28 +2,26 @@
 
 void MessagesEncoder::CmdmapRegisterCommand(string &command, uint16_t value)
 {
-    cmdmap[command] = value;
+    maps->cmdmap[command] = value;
 }
 
 void MessagesEncoder::CharmapRegisterCharacter(string &code, uint16_t value)
 {
-    charmap[code] = value;
+    maps->charmap.Insert(code, value);
 }
 
 void MessagesEncoder::ReadMessagesFromText(string& fname) {
     string text = ReadTextFile(fname);
-    size_t pos = 0;
-    do {
-        text = text.substr(pos);
-        if (text.empty())
+    string_view rest(text);
+    while (!rest.empty()) {
+        size_t pos = rest.find_first_of("\r\n");
+        vec_decoded.emplace_back(rest.substr(0, pos));
+        if (pos == string_view::npos)
             break;
-        pos = text.find_first_of("\r\n");
-        vec_decoded.push_back(text.substr(0, pos));
-        pos = text.find_last_of("\r\n", pos + 1, 2);
-        if (pos == string::npos)
-            break;
-        pos++;
-    } while (pos != string::npos);
+        // A line break is up to two characters out of '\r' and '\n'.
+        pos = rest.find_last_of("\r\n", pos + 1);
+        rest.remove_prefix(pos + 1);
+    }
     header.count = vec_decoded.size();
     debug_printf("%d lines\n", header.count);
 }
@@ -42,8 +40,9 @@ u16string MessagesEncoder::EncodeMessage(const string & message, int & i) {
             size_t pos = enclosed.find(' ');
             string command = enclosed.substr(0, pos);
             enclosed = enclosed.substr(pos + 1);
-            if (cmdmap.find(command) != cmdmap.end()) {
-                uint16_t command_i = cmdmap[command];
+            auto command_it = maps->cmdmap.find(command);
+            if (command_it != maps->cmdmap.end()) {
+                uint16_t command_i = command_it->second;
                 encoded += (char16_t)(0xFFFE);
                 debug_printf("%04X ", 0xFFFE);
                 vector<uint16_t> args;
@@ -78,25 +77,17 @@ u16string MessagesEncoder::EncodeMessage(const string & message, int & i) {
             }
         } else {
             uint16_t code = 0;
-            size_t k;
-            string substr;
-            for (k = 0; k < message.size() - j; k++) {
-                substr = message.substr(j, k + 1);
-                try {
-                    code = charmap.at(substr);
-                    break;
-                } catch (out_of_range& oor) { /* silently discard */}
-            }
-            if (code == 0 && substr != "\\x0000") {
+            size_t k = maps->charmap.Match(message, j, code);
+            if (k == 0 || (code == 0 && message.compare(j, k, "\\x0000") != 0)) {
                 stringstream ss;
-                ss << "unrecognized character in " << textfilename << ": line " << i << " pos " << (j + 1) << " value " << substr;
+                ss << "unrecognized character in " << textfilename << ": line " << i << " pos " << (j + 1) << " value " << message.substr(j, k ? k : string::npos);
                 throw runtime_error(ss.str());
             }
             debug_printf("%04X ", code);
             if (is_trname) {
                 if (code & ~0x1FF) {
                     stringstream ss;
-                    ss << "invalid character for bitpacked string: " << substr;
+                    ss << "invalid character for bitpacked string: " << message.substr(j, k);
                     throw runtime_error(ss.str());
                 }
                 trnamebuf |= code << bit;
@@ -109,7 +100,7 @@ u16string MessagesEncoder::EncodeMessage(const string & message, int & i) {
             } else {
                 encoded += (char16_t)(code);
             }
-            j += k;
+            j += k - 1;
         }
     }
     if (is_trname && bit > 1) {
@@ -3,11 +3,19 @@
 
 
 #include "MessagesConverter.h"
+#include "CharmapTrie.h"
 
-class MessagesEncoder : public MessagesConverter
+#include <memory>
+
+struct EncoderCharmap
 {
     map <string, uint16_t> cmdmap;
-    map <string, uint16_t> charmap;
+    CharmapTrie charmap;
+};
+
+class MessagesEncoder : public MessagesConverter
+{
+    shared_ptr<EncoderCharmap> maps;
 
     void ReadMessagesFromText(string& filename);
     void WriteMessagesToBin(string& filename);
@@ -15,7 +23,12 @@ class MessagesEncoder : public MessagesConverter
     void CharmapRegisterCharacter(string& code, uint16_t value) override;
     void CmdmapRegisterCommand(string& command, uint16_t value) override;
 public:
-    MessagesEncoder(string &_textfilename, int _key, string &_charmapfilename, string &_binfilename) : MessagesConverter(CONV_ENCODE, _textfilename, _key, _charmapfilename, _binfilename) {}
+    MessagesEncoder(string &_textfilename, int _key, string &_charmapfilename, string &_binfilename) : MessagesConverter(CONV_ENCODE, _textfilename, _key, _charmapfilename, _binfilename), maps(make_shared<EncoderCharmap>()) {}
+    // Use the charmap another encoder has already read instead of reading it again.
+    // The maps are only read while encoding, so encoders sharing them can run on separate threads.
+    void ShareCharmap(const MessagesEncoder &other) {
+        maps = other.maps;
+    }
     void ReadInput() override;
     void Convert() override;
     void WriteOutput() override;
@@ -3,11 +3,17 @@
  *
  * Usage:
  *     msgenc TXTFILE KEYFILE CHARMAP OUTFILE
+ *     msgenc -e -c CHARMAP -o OUTDIR [-p PREFIX] [-n NARC] TXTFILE...
  */
 
 #include <iostream>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <thread>
 #include "MessagesDecoder.h"
 #include "MessagesEncoder.h"
+#include "Narc.h"
 
 static const char* progname = "msgenc";
 static const char* version = "2021.08.27";
@@ -16,6 +22,7 @@ static const char* version = "2021.08.27";
 static inline void usage() {
     cout << progname << " v" << version << endl;
     cout << "Usage: " << progname << " [-h] [-v] -d|-e [-k KEY] -c CHARMAP INFILE OUTFILE" << endl;
+    cout << "       " << progname << " -e [-k KEY] -c CHARMAP -o OUTDIR [-p PREFIX] [-n NARC] [-j THREADS] INFILE..." << endl;
     cout << endl;
     cout << "INFILE        Required: Path to the input file to convert (-e: plaintext; -d: binary)." << endl;
     cout << "OUTFILE       Required: Path to the output file (-e: binary; -d: plaintext)." << endl;
@@ -26,6 +33,12 @@ static inline void usage() {
     cout << "-v            Print the program version and exit." << endl;
     cout << "-h            Print this message and exit." << endl;
     cout << "-D DUMPNAME   Dump the intermediate binary (after decryption or before encryption)." << endl;
+    cout << endl;
+    cout << "Encoding several banks at once:" << endl;
+    cout << "-o OUTDIR     Encode every INFILE to OUTDIR/PREFIX<INFILE name without extension>." << endl;
+    cout << "-p PREFIX     Prefix for the output file names. Default: none" << endl;
+    cout << "-n NARC       Afterwards pack every file in OUTDIR, in name order, into NARC." << endl;
+    cout << "-j THREADS    Number of banks to encode in parallel. Default: number of CPUs" << endl;
 }
 
 struct Options {
@@ -37,6 +50,10 @@ struct Options {
     bool printUsage = false;
     bool printVersion = false;
     string dumpBinary;
+    string outdir;
+    string prefix;
+    string narc;
+    int threads = 0;
     Options(int argc, char ** argv) {
         for (int i = 1; i < argc; i++) {
             string arg(argv[i]);
@@ -59,6 +76,14 @@ struct Options {
                 charmap = argv[++i];
             } else if (arg == "-D") {
                 dumpBinary = argv[++i];
+            } else if (arg == "-o") {
+                outdir = argv[++i];
+            } else if (arg == "-p") {
+                prefix = argv[++i];
+            } else if (arg == "-n") {
+                narc = argv[++i];
+            } else if (arg == "-j") {
+                threads = stoi(argv[++i]);
             } else if (arg[0] != '-') {
                 posargs.push_back(arg);
             } else {
@@ -66,7 +91,19 @@ struct Options {
                 break;
             }
         }
-        if (posargs.size() < 2) {
+        if (!outdir.empty()) {
+            if (posargs.empty()) {
+                failReason = "missing required positional argument: INFILE";
+            }
+            if (mode == CONV_DECODE) {
+                failReason = "-o is only supported when encoding";
+            }
+            if (!dumpBinary.empty()) {
+                failReason = "-D cannot be combined with -o";
+            }
+        } else if (!narc.empty()) {
+            failReason = "-n requires -o OUTDIR";
+        } else if (posargs.size() < 2) {
             failReason = "missing required positional argument: " + (string[]){"INFILE", "OUTFILE"}[posargs.size()];
         }
         if (mode == CONV_INVALID) {
@@ -78,6 +115,55 @@ struct Options {
     }
 };
 
+// Encodes every INFILE into options.outdir. The charmap is read once and
+// shared by all encoders, and the banks are spread over worker threads.
+static void EncodeBanks(Options &options) {
+    vector<unique_ptr<MessagesEncoder>> encoders;
+    for (string &infile : options.posargs) {
+        string outfile = options.outdir + "/" + options.prefix + filesystem::path(infile).stem().string();
+        encoders.emplace_back(new MessagesEncoder(infile, options.key, options.charmap, outfile));
+    }
+    encoders[0]->ReadCharmap();
+    for (size_t i = 1; i < encoders.size(); i++) {
+        encoders[i]->ShareCharmap(*encoders[0]);
+    }
+
+    vector<exception_ptr> errors(encoders.size());
+    atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i; (i = next++) < encoders.size();) {
+            try {
+                encoders[i]->ReadInput();
+                encoders[i]->Convert();
+                encoders[i]->WriteOutput();
+            } catch (...) {
+                errors[i] = current_exception();
+            }
+            encoders[i].reset();
+        }
+    };
+
+    size_t nthreads = options.threads > 0 ? options.threads : thread::hardware_concurrency();
+    nthreads = max<size_t>(1, min(nthreads, encoders.size()));
+    vector<thread> pool;
+    for (size_t i = 1; i < nthreads; i++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (thread &t : pool) {
+        t.join();
+    }
+
+    // report the first failing bank in command line order
+    for (exception_ptr &error : errors) {
+        if (error)
+            rethrow_exception(error);
+    }
+
+    if (!options.narc.empty())
+        CreateNarc(options.narc, ListMemberFiles(options.outdir));
+}
+
 int main(int argc, char ** argv) {
     try {
         Options options(argc, argv);
@@ -92,6 +178,11 @@ int main(int argc, char ** argv) {
             return 0;
         }
 
+        if (!options.outdir.empty()) {
+            EncodeBanks(options);
+            return 0;
+        }
+
         MessagesConverter *converter;
         if (options.mode == CONV_DECODE)
         {
@@ -120,6 +211,9 @@ int main(int argc, char ** argv) {
     } catch (runtime_error& exc) {
         cerr << "Runtime Error: " << exc.what() << endl;
         return 1;
+    } catch (narc_error& exc) {
+        cerr << "NARC Error: " << exc.what() << endl;
+        return 1;
     }
     return 0;
 }
@@ -0,0 +1,100 @@
+/*
+ * MSGENC_BENCH: Times msgenc's encoder and decoder over a directory of banks
+ *
+ * Usage:
+ *     msgenc_bench CHARMAP TEXTDIR [ITERATIONS]
+ */
+
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <algorithm>
+#include "MessagesDecoder.h"
+#include "MessagesEncoder.h"
+
+using Clock = chrono::steady_clock;
+
+static double Seconds(Clock::duration d) {
+    return chrono::duration<double>(d).count();
+}
+
+static void Report(const char *phase, double seconds, uintmax_t bytes, int iterations) {
+    double megabytes = bytes / (1024.0 * 1024.0) * iterations;
+    cout << left << setw(8) << phase << right << fixed << setprecision(3)
+         << setw(10) << seconds << " s" << setw(12) << setprecision(2) << (seconds > 0 ? megabytes / seconds : 0) << " MB/s" << endl;
+}
+
+int main(int argc, char ** argv) {
+    if (argc < 3) {
+        cerr << "Usage: msgenc_bench CHARMAP TEXTDIR [ITERATIONS]" << endl;
+        return 1;
+    }
+    string charmap = argv[1];
+    int iterations = argc > 3 ? stoi(argv[3]) : 10;
+
+    vector<string> banks;
+    uintmax_t textBytes = 0;
+    for (const auto &entry : filesystem::directory_iterator(argv[2])) {
+        if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+            banks.push_back(entry.path().string());
+            textBytes += entry.file_size();
+        }
+    }
+    sort(banks.begin(), banks.end());
+    if (banks.empty()) {
+        cerr << "no .txt banks in " << argv[2] << endl;
+        return 1;
+    }
+
+    filesystem::path workdir = filesystem::temp_directory_path() / "msgenc_bench";
+    filesystem::create_directories(workdir);
+
+    try {
+        Clock::duration charmapTime {}, encodeTime {}, decodeTime {};
+        uintmax_t binBytes = 0;
+
+        for (int iter = 0; iter < iterations; iter++) {
+            string dummy;
+            MessagesEncoder charmapOwner(dummy, 0, charmap, dummy);
+            auto start = Clock::now();
+            charmapOwner.ReadCharmap();
+            charmapTime += Clock::now() - start;
+
+            for (string &bank : banks) {
+                string binfile = (workdir / filesystem::path(bank).stem()).string();
+                string textfile = binfile + ".txt";
+
+                MessagesEncoder encoder(bank, 0, charmap, binfile);
+                encoder.ShareCharmap(charmapOwner);
+                start = Clock::now();
+                encoder.ReadInput();
+                encoder.Convert();
+                encodeTime += Clock::now() - start;
+                encoder.WriteOutput();
+                if (iter == 0)
+                    binBytes += filesystem::file_size(binfile);
+
+                MessagesDecoder decoder(textfile, 0, charmap, binfile);
+                decoder.ReadCharmap();
+                start = Clock::now();
+                decoder.ReadInput();
+                decoder.Convert();
+                decodeTime += Clock::now() - start;
+            }
+        }
+
+        cout << banks.size() << " banks, " << textBytes << " text bytes, " << binBytes << " binary bytes, "
+             << iterations << " iterations" << endl;
+        Report("charmap", Seconds(charmapTime), filesystem::file_size(charmap), iterations);
+        Report("encode", Seconds(encodeTime), textBytes, iterations);
+        Report("decode", Seconds(decodeTime), binBytes, iterations);
+    } catch (exception &e) {
+        cerr << "Error: " << e.what() << endl;
+        filesystem::remove_all(workdir);
+        return 1;
+    }
+    filesystem::remove_all(workdir);
+    return 0;
+}
@@ -0,0 +1,355 @@
+#include <algorithm>
+#include <tuple>
+#include <cstring>
+#include <filesystem>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+#include "Narc.h"
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+static int OpenFile(const string &filename, int flags) {
+    int fd = open(filename.c_str(), flags | O_BINARY, 0644);
+    if (fd < 0) {
+        throw narc_error("Unable to open file \"" + filename + "\": " + strerror(errno));
+    }
+    return fd;
+}
+
+static void WriteAll(int fd, const void *data, size_t size, const string &filename) {
+    const char *p = static_cast<const char *>(data);
+    while (size != 0) {
+        auto written = write(fd, p, size);
+        if (written <= 0) {
+            throw narc_error("Unable to write file \"" + filename + "\": " + strerror(errno));
+        }
+        p += written;
+        size -= written;
+    }
+}
+
+// Streams size bytes of infile into outfd at its current position.
+static void CopyFileContents(int outfd, const string &infile, size_t size, const string &outfile) {
+    if (size == 0) {
+        return;
+    }
+    int infd = OpenFile(infile, O_RDONLY);
+#ifdef __linux__
+    while (size != 0) {
+        auto copied = sendfile(outfd, infd, nullptr, size);
+        if (copied <= 0) {
+            close(infd);
+            throw narc_error("Unable to copy \"" + infile + "\" into \"" + outfile + "\": " + strerror(errno));
+        }
+        size -= copied;
+    }
+#else
+    char buffer[0x10000];
+    while (size != 0) {
+        auto nread = read(infd, buffer, min(size, sizeof(buffer)));
+        if (nread <= 0) {
+            close(infd);
+            throw narc_error("Unable to read file \"" + infile + "\"");
+        }
+        WriteAll(outfd, buffer, nread, outfile);
+        size -= nread;
+    }
+#endif
+    close(infd);
+}
+
+MappedFile::MappedFile(const string &filename) {
+    int fd = OpenFile(filename, O_RDONLY);
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw narc_error("Unable to stat file \"" + filename + "\"");
+    }
+    _size = st.st_size;
+    if (_size == 0) {
+        close(fd);
+        return;
+    }
+#ifdef _WIN32
+    _buffer.resize(_size);
+    size_t total = 0;
+    while (total < _size) {
+        auto nread = read(fd, _buffer.data() + total, _size - total);
+        if (nread <= 0) {
+            close(fd);
+            throw narc_error("Unable to read file \"" + filename + "\"");
+        }
+        total += nread;
+    }
+    _data = _buffer.data();
+#else
+    void *map = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        throw narc_error("Unable to map file \"" + filename + "\": " + strerror(errno));
+    }
+    _data = static_cast<const unsigned char *>(map);
+#endif
+    close(fd);
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (_data != nullptr) {
+        munmap(const_cast<unsigned char *>(_data), _size);
+    }
+#endif
+}
+
+NarcReader::NarcReader(const string &narcfilename) : file(narcfilename) {
+    NarcHeader narc;
+    FileAllocationTable fat;
+    FileNameTable fnt;
+    FileImages fimg;
+    auto readChunk = [&](size_t offset, void *chunk, size_t size, uint32_t id) {
+        if (offset + size > file.size()) {
+            throw narc_error("\"" + narcfilename + "\" is truncated");
+        }
+        memcpy(chunk, file.data() + offset, size);
+        if (*static_cast<uint32_t *>(chunk) != id) {
+            throw narc_error("\"" + narcfilename + "\" is not a NARC");
+        }
+    };
+
+    readChunk(0, &narc, sizeof(narc), NarcHeader().Id);
+    size_t offset = narc.ChunkSize;
+    readChunk(offset, &fat, sizeof(fat), FileAllocationTable().Id);
+    if (sizeof(fat) + fat.FileCount * sizeof(FileAllocationTableEntry) > fat.ChunkSize
+        || offset + fat.ChunkSize > file.size()) {
+        throw narc_error("\"" + narcfilename + "\" has a corrupt FAT");
+    }
+    fatent.resize(fat.FileCount);
+    memcpy(fatent.data(), file.data() + offset + sizeof(fat), fatent.size() * sizeof(FileAllocationTableEntry));
+    offset += fat.ChunkSize;
+    readChunk(offset, &fnt, sizeof(fnt), FileNameTable().Id);
+    offset += fnt.ChunkSize;
+    readChunk(offset, &fimg, sizeof(fimg), FileImages().Id);
+    imagesOffset = offset + sizeof(fimg);
+
+    for (const auto &entry : fatent) {
+        if (entry.End < entry.Start || imagesOffset + entry.End > file.size()) {
+            throw narc_error("\"" + narcfilename + "\" has a member outside its image chunk");
+        }
+    }
+}
+
+// Sort key for a member file name: names ending in _N sort by the part
+// before N, then by N as a number, so an unpadded _10 lands after _9.
+struct MemberSortKey {
+    string stem;
+    bool numbered = false;
+    uint64_t index = 0;
+    string name;
+
+    explicit MemberSortKey(const string &filename) : stem(filename), name(filename) {
+        size_t digits = filename.find_last_not_of("0123456789");
+        if (digits != string::npos && digits + 1 < filename.size() && filename[digits] == '_'
+            && filename.size() - digits - 1 <= 18) {
+            stem = filename.substr(0, digits + 1);
+            numbered = true;
+            index = stoull(filename.substr(digits + 1));
+        }
+    }
+
+    bool operator<(const MemberSortKey &other) const {
+        return tie(stem, numbered, index, name) < tie(other.stem, other.numbered, other.index, other.name);
+    }
+};
+
+vector<string> ListMemberFiles(const string &dirname) {
+    vector<pair<MemberSortKey, string>> entries;
+    for (const auto &entry : filesystem::directory_iterator(dirname)) {
+        if (entry.is_regular_file()) {
+            entries.emplace_back(MemberSortKey(entry.path().filename().string()), entry.path().string());
+        }
+    }
+    sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) {
+        return a.first < b.first;
+    });
+    vector<string> members;
+    members.reserve(entries.size());
+    for (auto &entry : entries) {
+        members.push_back(move(entry.second));
+    }
+    return members;
+}
+
+// FAT entries and header values CreateNarc writes for members of these sizes.
+static void LayoutNarc(const vector<uint64_t> &sizes, vector<FileAllocationTableEntry> &fatent,
+                       NarcHeader &narc, FileAllocationTable &fat, FileImages &fimg) {
+    fatent.resize(sizes.size());
+    uint64_t offset = 0;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        if (offset + sizes[i] > UINT32_MAX) {
+            throw narc_error("members are too large for a NARC");
+        }
+        fatent[i].Start = offset;
+        fatent[i].End = offset + sizes[i];
+        offset = (fatent[i].End + 3) & ~3ull;
+    }
+    if (sizes.size() > UINT16_MAX) {
+        throw narc_error("too many members for a NARC");
+    }
+    fat.FileCount = sizes.size();
+    fat.ChunkSize = sizeof(FileAllocationTable) + sizes.size() * sizeof(FileAllocationTableEntry);
+    fimg.ChunkSize = sizeof(FileImages) + (sizes.empty() ? 0 : fatent.back().End);
+    narc.FileSize = sizeof(NarcHeader) + fat.ChunkSize + FileNameTable().ChunkSize + fimg.ChunkSize;
+}
+
+static vector<uint64_t> GetMemberSizes(const vector<string> &memberfiles) {
+    vector<uint64_t> sizes;
+    sizes.reserve(memberfiles.size());
+    for (const auto &member : memberfiles) {
+        sizes.push_back(filesystem::file_size(member));
+    }
+    return sizes;
+}
+
+// Everything CreateNarc writes before the first member.
+static vector<unsigned char> BuildNarcHeaders(const vector<FileAllocationTableEntry> &fatent, const NarcHeader &narc,
+                                              const FileAllocationTable &fat, const FileImages &fimg) {
+    FileNameTable fnt;
+    FileNameTableEntry fntent;
+    vector<unsigned char> headers;
+    auto append = [&](const void *data, size_t size) {
+        headers.insert(headers.end(), (const unsigned char *)data, (const unsigned char *)data + size);
+    };
+    append(&narc, sizeof(narc));
+    append(&fat, sizeof(fat));
+    append(fatent.data(), fatent.size() * sizeof(FileAllocationTableEntry));
+    append(&fnt, sizeof(fnt));
+    append(&fntent, sizeof(fntent));
+    append(&fimg, sizeof(fimg));
+    return headers;
+}
+
+void CreateNarc(const string &narcfilename, const vector<string> &memberfiles) {
+    vector<uint64_t> sizes = GetMemberSizes(memberfiles);
+    vector<FileAllocationTableEntry> fatent;
+    NarcHeader narc;
+    FileAllocationTable fat;
+    FileImages fimg;
+    LayoutNarc(sizes, fatent, narc, fat, fimg);
+    vector<unsigned char> headers = BuildNarcHeaders(fatent, narc, fat, fimg);
+
+    int fd = OpenFile(narcfilename, O_WRONLY | O_CREAT | O_TRUNC);
+    try {
+        WriteAll(fd, headers.data(), headers.size(), narcfilename);
+        for (size_t i = 0; i < memberfiles.size(); i++) {
+            if (i != 0) {
+                static const unsigned char padding[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+                WriteAll(fd, padding, fatent[i].Start - fatent[i - 1].End, narcfilename);
+            }
+            CopyFileContents(fd, memberfiles[i], sizes[i], narcfilename);
+        }
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+    close(fd);
+}
+
+void ExtractNarc(const string &narcfilename, const string &dirname) {
+    NarcReader reader(narcfilename);
+    filesystem::create_directories(dirname);
+
+    string prefix = filesystem::path(narcfilename).filename().string() + "_";
+    size_t count = reader.GetMemberCount();
+    size_t width = count < 2 ? 1 : to_string(count - 1).size();
+    for (size_t i = 0; i < count; i++) {
+        string index = to_string(i);
+        index.insert(0, width - index.size(), '0');
+        string membername = (filesystem::path(dirname) / (prefix + index)).string();
+        int fd = OpenFile(membername, O_WRONLY | O_CREAT | O_TRUNC);
+        try {
+            WriteAll(fd, reader.GetMemberData(i), reader.GetMemberSize(i), membername);
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+    }
+}
+
+size_t UpdateNarc(const string &narcfilename, const vector<string> &memberfiles) {
+    vector<uint64_t> sizes = GetMemberSizes(memberfiles);
+    vector<FileAllocationTableEntry> fatent;
+    NarcHeader narc;
+    FileAllocationTable fat;
+    FileImages fimg;
+    LayoutNarc(sizes, fatent, narc, fat, fimg);
+
+    vector<size_t> changed;
+    vector<size_t> offsets;
+    bool sameLayout = false;
+    if (filesystem::exists(narcfilename)) {
+        try {
+            // Patching members in place is only the same as a rewrite if every
+            // byte outside them already matches, so check the headers, FAT,
+            // FNT and padding as well as the member sizes.
+            vector<unsigned char> headers = BuildNarcHeaders(fatent, narc, fat, fimg);
+            MappedFile existing(narcfilename);
+            sameLayout = existing.size() == narc.FileSize
+                         && memcmp(existing.data(), headers.data(), headers.size()) == 0;
+            for (size_t i = 1; sameLayout && i < memberfiles.size(); i++) {
+                for (size_t pad = headers.size() + fatent[i - 1].End; pad < headers.size() + fatent[i].Start; pad++) {
+                    sameLayout = sameLayout && existing.data()[pad] == 0xFF;
+                }
+            }
+            for (size_t i = 0; sameLayout && i < memberfiles.size(); i++) {
+                if (sizes[i] == 0) {
+                    continue;
+                }
+                MappedFile member(memberfiles[i]);
+                size_t offset = headers.size() + fatent[i].Start;
+                if (memcmp(member.data(), existing.data() + offset, sizes[i]) != 0) {
+                    changed.push_back(i);
+                    offsets.push_back(offset);
+                }
+            }
+        } catch (const narc_error &) {
+            sameLayout = false;
+        }
+    }
+
+    if (!sameLayout) {
+        CreateNarc(narcfilename, memberfiles);
+        return memberfiles.size();
+    }
+    if (changed.empty()) {
+        // Still bump the timestamp so make sees the archive as up to date.
+        filesystem::last_write_time(narcfilename, filesystem::file_time_type::clock::now());
+        return 0;
+    }
+
+    int fd = OpenFile(narcfilename, O_WRONLY);
+    try {
+        for (size_t i = 0; i < changed.size(); i++) {
+            if (lseek(fd, offsets[i], SEEK_SET) < 0) {
+                throw narc_error("Unable to seek in \"" + narcfilename + "\"");
+            }
+            CopyFileContents(fd, memberfiles[changed[i]], sizes[changed[i]], narcfilename);
+        }
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+    close(fd);
+    return changed.size();
+}
@@ -0,0 +1,67 @@
+#ifndef GUARD_NARC_H
+#define GUARD_NARC_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "NarcFormat.h"
+
+using namespace std;
+
+class narc_error : public exception {
+    string _what;
+public:
+    explicit narc_error(const string &s) : _what(s) {}
+    const char *what() const noexcept override { return _what.c_str(); }
+};
+
+// Read-only view of a whole file, mapped where the platform allows it.
+class MappedFile {
+    const unsigned char *_data = nullptr;
+    size_t _size = 0;
+    vector<unsigned char> _buffer;
+public:
+    explicit MappedFile(const string &filename);
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    const unsigned char *data() const { return _data; }
+    size_t size() const { return _size; }
+};
+
+// Parses the chunks of an existing NARC. The FNT is skipped, so archives
+// with file names can be read too.
+class NarcReader {
+    MappedFile file;
+    vector<FileAllocationTableEntry> fatent;
+    size_t imagesOffset = 0;
+public:
+    explicit NarcReader(const string &narcfilename);
+    size_t GetMemberCount() const { return fatent.size(); }
+    size_t GetMemberOffset(size_t i) const { return imagesOffset + fatent[i].Start; }
+    uint32_t GetMemberSize(size_t i) const { return fatent[i].End - fatent[i].Start; }
+    const unsigned char *GetMemberData(size_t i) const { return file.data() + GetMemberOffset(i); }
+};
+
+// Regular files in dirname, sorted by name, except that names which only
+// differ in a trailing _N index are sorted by N as a number, so <name>_10
+// comes after <name>_9. Zero-padded names keep the order `narcpy.py create`
+// gave them.
+vector<string> ListMemberFiles(const string &dirname);
+
+// Writes the archive narcpy.py built: members start on 4-byte boundaries,
+// gaps are filled with 0xFF and each FAT entry ends exactly at its member.
+void CreateNarc(const string &narcfilename, const vector<string> &memberfiles);
+
+// Writes every member to dirname as <basename of narcfilename>_<index>, the
+// index zero-padded to the width of the last index.
+void ExtractNarc(const string &narcfilename, const string &dirname);
+
+// Rewrites only the members whose contents differ from memberfiles when the
+// archive's headers, FAT, FNT and padding already match what CreateNarc would
+// write, and falls back to CreateNarc otherwise.
+// Returns the number of members written.
+size_t UpdateNarc(const string &narcfilename, const vector<string> &memberfiles);
+
+#endif //GUARD_NARC_H
@@ -1,15 +1,19 @@
-#ifndef GUARD_NARC_H
-#define GUARD_NARC_H
+#ifndef GUARD_NARC_FORMAT_H
+#define GUARD_NARC_FORMAT_H
 
+#include <cstdint>
 #include <vector>
 
+// The NARC chunks narc and o2narc write: one FAT entry per member, a
+// single-directory FNT without names, and the member images.
+
 struct FileAllocationTableEntry
 {
     uint32_t Start = 0;
     uint32_t End = 0;
     static std::vector<FileAllocationTableEntry> _make(std::vector<uint32_t> &sizes) {
         std::vector<FileAllocationTableEntry> ret(sizes.size());
-        for (int i = 0; i < sizes.size(); i++) {
+        for (size_t i = 0; i < sizes.size(); i++) {
             if (i == 0) {
                 ret[i].Start = 0;
             } else {
@@ -27,6 +31,7 @@ struct FileAllocationTable
     uint32_t ChunkSize = sizeof(FileAllocationTable);
     uint16_t FileCount = 0;
     uint16_t Reserved = 0;
+    FileAllocationTable() = default;
     FileAllocationTable(std::vector<FileAllocationTableEntry> &sizes) {
         FileCount = sizes.size();
         ChunkSize += FileCount * sizeof(FileAllocationTableEntry);
@@ -49,7 +54,8 @@ struct FileNameTable
 struct FileImages
 {
     uint32_t Id = 0x46494d47;
-    uint32_t ChunkSize = 0;
+    uint32_t ChunkSize = sizeof(FileImages);
+    FileImages() = default;
     template <typename T>
     explicit FileImages(std::vector<T> &data) {
         ChunkSize = data.size() * sizeof(T) + sizeof(FileImages);
@@ -70,4 +76,4 @@ struct NarcHeader
     }
 };
 
-#endif //GUARD_NARC_H
+#endif //GUARD_NARC_FORMAT_H
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include "Narc.h"
+
+using namespace std;
+
+class command_error : public exception {
+    string _what;
+public:
+    explicit command_error(const string &s) : _what(s) {}
+    const char *what() const noexcept override { return _what.c_str(); }
+};
+
+static inline void usage() {
+    cout << "Usage: narc create NARC DIR" << endl;
+    cout << "       narc update NARC DIR" << endl;
+    cout << "       narc extract NARC -o DIR" << endl;
+    cout << "       narc list NARC" << endl;
+    cout << endl;
+    cout << "Commands:" << endl;
+    cout << "\tcreate\tPack the files in DIR, in name order, into NARC" << endl;
+    cout << "\tupdate\tLike create, but only rewrite the members that changed when NARC already has the same layout" << endl;
+    cout << "\textract\tWrite each member of NARC to DIR as <NARC basename>_<index>" << endl;
+    cout << "\tlist\tPrint the offset and size of each member" << endl;
+    cout << "Options:" << endl;
+    cout << "\t-nf\tAccepted for compatibility with narcpy.py; archives never carry file names" << endl;
+}
+
+static void ListNarc(const string &narcfilename) {
+    NarcReader reader(narcfilename);
+    size_t count = reader.GetMemberCount();
+    cout << count << " members" << endl;
+    for (size_t i = 0; i < count; i++) {
+        cout << setw(5) << i
+             << "  0x" << hex << setw(8) << setfill('0') << reader.GetMemberOffset(i)
+             << setfill(' ') << dec << "  " << reader.GetMemberSize(i) << endl;
+    }
+}
+
+int main(int argc, char ** argv) {
+    try {
+        vector<string> posargs;
+        string outdir;
+        for (int i = 1; i < argc; i++) {
+            string arg{argv[i]};
+            if (arg == "-nf") {
+                continue;
+            } else if (arg == "-o") {
+                if (++i == argc) {
+                    throw command_error("missing argument for -o");
+                }
+                outdir = argv[i];
+            } else if (arg[0] == '-') {
+                throw command_error("unrecognized option flag: " + arg);
+            } else {
+                posargs.emplace_back(arg);
+            }
+        }
+        if (posargs.empty()) {
+            throw command_error("missing command");
+        }
+
+        const string &command = posargs[0];
+        if (command == "create" || command == "update") {
+            if (posargs.size() != 3) {
+                throw command_error(command + " takes NARC and DIR");
+            }
+            vector<string> members = ListMemberFiles(posargs[2]);
+            if (command == "create") {
+                CreateNarc(posargs[1], members);
+            } else {
+                UpdateNarc(posargs[1], members);
+            }
+        } else if (command == "extract") {
+            if (posargs.size() != 2 || outdir.empty()) {
+                throw command_error("extract takes NARC and -o DIR");
+            }
+            ExtractNarc(posargs[1], outdir);
+        } else if (command == "list") {
+            if (posargs.size() != 2) {
+                throw command_error("list takes NARC");
+            }
+            ListNarc(posargs[1]);
+        } else {
+            throw command_error("unrecognized command: " + command);
+        }
+        return 0;
+    } catch (const command_error &e) {
+        usage();
+        cerr << e.what() << endl;
+        return 1;
+    } catch (const narc_error &e) {
+        cerr << e.what() << endl;
+        return 1;
+    } catch (const filesystem::filesystem_error &e) {
+        cerr << e.what() << endl;
+        return 1;
+    } catch (const exception &e) {
+        cerr << "Unhandled exception: " << e.what() << endl;
+        return 1;
+    }
+}
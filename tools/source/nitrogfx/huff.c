@@ -367,7 +367,7 @@ unsigned char * HuffDecompress(unsigned char * src, int srcSize, int * uncompres
 
     for (;;)
     {
-        if (srcPos >= srcSize)
+        if (srcPos + 4 > srcSize)
             goto fail;
         read_32_le(src, &srcPos, &window);
         for (int i = 0; i < 32; i++) {
@@ -21,6 +21,37 @@ unsigned char *LZDecompress(unsigned char *src, int srcSize, int *uncompressedSi
 	int destPos = 0;
 
 	for (;;) {
+		// A flag group consumes at most 1 + 8 * 2 source bytes and produces
+		// at most 8 * 18 bytes, so while that much is left on both sides the
+		// whole group can be decoded without per-token bounds checks.
+		while (srcPos + 17 <= srcSize && destPos + 8 * 18 <= destSize) {
+			unsigned char flags = src[srcPos++];
+
+			for (int i = 0; i < 8; i++) {
+				if (flags & 0x80) {
+					int blockSize = (src[srcPos] >> 4) + 3;
+					int blockPos = destPos - ((((src[srcPos] & 0xF) << 8) | src[srcPos + 1]) + 1);
+
+					srcPos += 2;
+
+					if (blockPos < 0)
+						goto fail;
+
+					for (int j = 0; j < blockSize; j++)
+						dest[destPos++] = dest[blockPos + j];
+				} else {
+					dest[destPos++] = src[srcPos++];
+				}
+
+				flags <<= 1;
+			}
+
+			if (destPos == destSize) {
+				*uncompressedSize = destSize;
+				return dest;
+			}
+		}
+
 		if (srcPos >= srcSize)
 			goto fail;
 
@@ -69,11 +100,107 @@ fail:
 	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
 }
 
-unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_MATCH 18
+#define LZ_MAX_DISTANCE 0x1000
+#define LZ_HASH_BITS 15
+#define LZ_HASH_SIZE (1 << LZ_HASH_BITS)
+
+// Hash chains over 3-byte prefixes. Every chain is ordered from the most recent
+// position to the oldest, so candidates are visited in increasing distance.
+struct LZMatchFinder {
+	unsigned char *src;
+	int srcSize;
+	int minDistance;
+	int insertPos;
+	int *head;
+	int *prev;
+};
+
+static inline unsigned int LZHash(const unsigned char *p)
 {
-	if (srcSize <= 0)
-		goto fail;
+	return (((unsigned int)p[0] << 16 | p[1] << 8 | p[2]) * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static void LZInitMatchFinder(struct LZMatchFinder *mf, unsigned char *src, int srcSize, int minDistance)
+{
+	mf->src = src;
+	mf->srcSize = srcSize;
+	mf->minDistance = minDistance;
+	mf->insertPos = 0;
+	mf->head = malloc(LZ_HASH_SIZE * sizeof(int));
+	mf->prev = malloc(srcSize * sizeof(int));
+
+	if (mf->head == NULL || mf->prev == NULL)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
+
+	for (int i = 0; i < LZ_HASH_SIZE; i++)
+		mf->head[i] = -1;
+}
+
+static void LZFreeMatchFinder(struct LZMatchFinder *mf)
+{
+	free(mf->head);
+	free(mf->prev);
+}
+
+// Returns the longest match (at least LZ_MIN_MATCH bytes) for srcPos, or 0 if
+// there is none. Of equally long matches the one with the smallest distance is
+// chosen, which is what the original brute-force search produced.
+static int LZFindLongestMatch(struct LZMatchFinder *mf, int srcPos, int *matchDistance)
+{
+	unsigned char *src = mf->src;
+	int maxSize = mf->srcSize - srcPos;
+
+	while (mf->insertPos < srcPos && mf->insertPos + LZ_MIN_MATCH <= mf->srcSize) {
+		unsigned int hash = LZHash(&src[mf->insertPos]);
+		mf->prev[mf->insertPos] = mf->head[hash];
+		mf->head[hash] = mf->insertPos;
+		mf->insertPos++;
+	}
+
+	if (maxSize < LZ_MIN_MATCH)
+		return 0;
+
+	if (maxSize > LZ_MAX_MATCH)
+		maxSize = LZ_MAX_MATCH;
+
+	int bestSize = 0;
+
+	for (int candidate = mf->head[LZHash(&src[srcPos])]; candidate >= 0; candidate = mf->prev[candidate]) {
+		int distance = srcPos - candidate;
+
+		if (distance > LZ_MAX_DISTANCE)
+			break;
+
+		if (distance < mf->minDistance)
+			continue;
+
+		// a longer match has to agree on the byte just past the current best
+		if (src[candidate + bestSize] != src[srcPos + bestSize])
+			continue;
+
+		int size = 0;
+
+		while (size < maxSize && src[candidate + size] == src[srcPos + size])
+			size++;
+
+		if (size > bestSize) {
+			bestSize = size;
+			*matchDistance = distance;
 
+			if (size == maxSize)
+				break;
+		}
+	}
+
+	return bestSize >= LZ_MIN_MATCH ? bestSize : 0;
+}
+
+// Writes the token stream chosen by the parser. matchSizes[pos] is 0 for a
+// literal, otherwise a match of that size at distance matchDistances[pos].
+static unsigned char *LZEncode(unsigned char *src, int srcSize, const int *matchSizes, const int *matchDistances, int *compressedSize)
+{
 	int worstCaseDestSize = 4 + srcSize + ((srcSize + 7) / 8);
 
 	// Round up to the next multiple of four.
@@ -82,7 +209,7 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 	unsigned char *dest = malloc(worstCaseDestSize);
 
 	if (dest == NULL)
-		goto fail;
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
 
 	// header
 	dest[0] = 0x10; // LZ compression type
@@ -98,37 +225,14 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 		*flags = 0;
 
 		for (int i = 0; i < 8; i++) {
-			int bestBlockDistance = 0;
-			int bestBlockSize = 0;
-			int blockDistance = minDistance;
-
-			while (blockDistance <= srcPos && blockDistance <= 0x1000) {
-				int blockStart = srcPos - blockDistance;
-				int blockSize = 0;
-
-				while (blockSize < 18
-				    && srcPos + blockSize < srcSize
-				    && src[blockStart + blockSize] == src[srcPos + blockSize])
-					blockSize++;
-
-				if (blockSize > bestBlockSize) {
-					bestBlockDistance = blockDistance;
-					bestBlockSize = blockSize;
-
-					if (blockSize == 18)
-						break;
-				}
-
-				blockDistance++;
-			}
+			if (matchSizes[srcPos] != 0) {
+				int blockSize = matchSizes[srcPos] - 3;
+				int blockDistance = matchDistances[srcPos] - 1;
 
-			if (bestBlockSize >= 3) {
 				*flags |= (0x80 >> i);
-				srcPos += bestBlockSize;
-				bestBlockSize -= 3;
-				bestBlockDistance--;
-				dest[destPos++] = (bestBlockSize << 4) | ((unsigned int)bestBlockDistance >> 8);
-				dest[destPos++] = (unsigned char)bestBlockDistance;
+				srcPos += matchSizes[srcPos];
+				dest[destPos++] = (blockSize << 4) | ((unsigned int)blockDistance >> 8);
+				dest[destPos++] = (unsigned char)blockDistance;
 			} else {
 				dest[destPos++] = src[srcPos++];
 			}
@@ -147,6 +251,91 @@ unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize,
 			}
 		}
 	}
+}
+
+// Greedy parse: always take the longest match at the current position.
+// The output is byte-identical to the original exhaustive search.
+unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	if (srcSize <= 0)
+		goto fail;
+
+	int *matchSizes = calloc(srcSize, sizeof(int));
+	int *matchDistances = calloc(srcSize, sizeof(int));
+
+	if (matchSizes == NULL || matchDistances == NULL)
+		goto fail;
+
+	struct LZMatchFinder mf;
+	LZInitMatchFinder(&mf, src, srcSize, minDistance);
+
+	int srcPos = 0;
+
+	while (srcPos < srcSize) {
+		matchSizes[srcPos] = LZFindLongestMatch(&mf, srcPos, &matchDistances[srcPos]);
+		srcPos += matchSizes[srcPos] != 0 ? matchSizes[srcPos] : 1;
+	}
+
+	LZFreeMatchFinder(&mf);
+
+	unsigned char *dest = LZEncode(src, srcSize, matchSizes, matchDistances, compressedSize);
+
+	free(matchSizes);
+	free(matchDistances);
+
+	return dest;
+
+fail:
+	FATAL_ERROR("Fatal error while compressing LZ file.\n");
+}
+
+// Optimal parse: picks the sequence of literals and matches with the fewest
+// encoded bits (9 per literal, 17 per match including the flag bit).
+// Any prefix of the longest match is also a valid match at the same distance,
+// so the longest match per position is all the parser needs.
+unsigned char *LZCompressOptimal(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	if (srcSize <= 0)
+		goto fail;
+
+	int *longestSizes = malloc(srcSize * sizeof(int));
+	int *matchDistances = malloc(srcSize * sizeof(int));
+	int *matchSizes = calloc(srcSize, sizeof(int));
+	unsigned int *cost = malloc((srcSize + 1) * sizeof(unsigned int));
+
+	if (longestSizes == NULL || matchDistances == NULL || matchSizes == NULL || cost == NULL)
+		goto fail;
+
+	struct LZMatchFinder mf;
+	LZInitMatchFinder(&mf, src, srcSize, minDistance);
+
+	for (int srcPos = 0; srcPos < srcSize; srcPos++)
+		longestSizes[srcPos] = LZFindLongestMatch(&mf, srcPos, &matchDistances[srcPos]);
+
+	LZFreeMatchFinder(&mf);
+
+	cost[srcSize] = 0;
+
+	for (int srcPos = srcSize - 1; srcPos >= 0; srcPos--) {
+		cost[srcPos] = 9 + cost[srcPos + 1];
+		matchSizes[srcPos] = 0;
+
+		for (int size = LZ_MIN_MATCH; size <= longestSizes[srcPos]; size++) {
+			if (17 + cost[srcPos + size] <= cost[srcPos]) {
+				cost[srcPos] = 17 + cost[srcPos + size];
+				matchSizes[srcPos] = size;
+			}
+		}
+	}
+
+	unsigned char *dest = LZEncode(src, srcSize, matchSizes, matchDistances, compressedSize);
+
+	free(longestSizes);
+	free(matchDistances);
+	free(matchSizes);
+	free(cost);
+
+	return dest;
 
 fail:
 	FATAL_ERROR("Fatal error while compressing LZ file.\n");
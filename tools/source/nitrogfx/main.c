@@ -4,6 +4,11 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "global.h"
 #include "util.h"
 #include "options.h"
@@ -946,6 +951,7 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
 {
     int overflowSize = 0;
     int minDistance = 2; // default, for compatibility with LZ77UnCompVram()
+    bool optimal = false;
 
     for (int i = 3; i < argc; i++)
     {
@@ -977,6 +983,10 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
             if (minDistance < 1)
                 FATAL_ERROR("LZ min search distance must be positive.\n");
         }
+        else if (strcmp(option, "-optimal") == 0)
+        {
+            optimal = true;
+        }
         else
         {
             FATAL_ERROR("Unrecognized option \"%s\".\n", option);
@@ -993,7 +1003,14 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
     unsigned char *buffer = ReadWholeFileZeroPadded(inputPath, &fileSize, overflowSize);
 
     int compressedSize;
-    unsigned char *compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    unsigned char *compressedData;
+
+    // -optimal trades compression time for the smallest output; the default
+    // greedy parse matches the output of older nitrogfx builds byte for byte
+    if (optimal)
+        compressedData = LZCompressOptimal(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    else
+        compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
 
     compressedData[1] = (unsigned char)fileSize;
     compressedData[2] = (unsigned char)(fileSize >> 8);
@@ -1106,55 +1123,50 @@ void HandleHuffDecompressCommand(char *inputPath, char *outputPath, int argc UNU
     free(uncompressedData);
 }
 
-int main(int argc, char **argv)
+static const struct CommandHandler handlers[] =
 {
-    if (argc < 3)
-        FATAL_ERROR("Usage: nitrogfx INPUT_PATH OUTPUT_PATH [options...]\n");
-
-    struct CommandHandler handlers[] =
-    {
-        { "1bpp", "png", HandleGbaToPngCommand },
-        { "4bpp", "png", HandleGbaToPngCommand },
-        { "8bpp", "png", HandleGbaToPngCommand },
-        { "nbfc", "png", HandleGbaToPngCommand },
-        { "NCGR", "png", HandleNtrToPngCommand },
-        { "png", "1bpp", HandlePngToGbaCommand },
-        { "png", "4bpp", HandlePngToGbaCommand },
-        { "png", "nbfc", HandlePngToGbaCommand },
-        { "png", "8bpp", HandlePngToGbaCommand },
-        { "png", "NCGR", HandlePngToNtrCommand },
-        { "png", "gbapal", HandlePngToGbaPaletteCommand },
-        { "png", "nbfp", HandlePngToGbaPaletteCommand },
-        { "png", "NCLR", HandlePngToNtrPaletteCommand },
-        { "gbapal", "pal", HandleGbaToJascPaletteCommand },
-        { "NCLR", "pal", HandleNtrToJascPaletteCommand },
-        { "NCPR", "pal", HandleNtrToJascPaletteCommand },
-        { "pal", "gbapal", HandleJascToGbaPaletteCommand },
-        { "pal", "NCLR", HandleJascToNtrPaletteCommand },
-        { "latfont", "png", HandleLatinFontToPngCommand },
-        { "png", "latfont", HandlePngToLatinFontCommand },
-        { "hwjpnfont", "png", HandleHalfwidthJapaneseFontToPngCommand },
-        { "png", "hwjpnfont", HandlePngToHalfwidthJapaneseFontCommand },
-        { "fwjpnfont", "png", HandleFullwidthJapaneseFontToPngCommand },
-        { "png", "fwjpnfont", HandlePngToFullwidthJapaneseFontCommand },
-        { "json", "NCER", HandleJsonToNtrCellCommand },
-        { "NCER", "json", HandleNtrCellToJsonCommand },
-        { "json", "NSCR", HandleJsonToNtrScreenCommand },
-        { "json", "NANR", HandleJsonToNtrAnimationCommand },
-        { "NANR", "json", HandleNtrAnimationToJsonCommand },
-        { "json", "NMAR", HandleJsonToNtrMulticellAnimationCommand },
-        { "NMAR", "json", HandleNtrAnimationToJsonCommand },
-        { NULL, "huff", HandleHuffCompressCommand },
-        { NULL, "lz", HandleLZCompressCommand },
-        { "huff", NULL, HandleHuffDecompressCommand },
-        { "lz", NULL, HandleLZDecompressCommand },
-        { NULL, "rl", HandleRLCompressCommand },
-        { "rl", NULL, HandleRLDecompressCommand },
-        { NULL, NULL, NULL }
-    };
+    { "1bpp", "png", HandleGbaToPngCommand },
+    { "4bpp", "png", HandleGbaToPngCommand },
+    { "8bpp", "png", HandleGbaToPngCommand },
+    { "nbfc", "png", HandleGbaToPngCommand },
+    { "NCGR", "png", HandleNtrToPngCommand },
+    { "png", "1bpp", HandlePngToGbaCommand },
+    { "png", "4bpp", HandlePngToGbaCommand },
+    { "png", "nbfc", HandlePngToGbaCommand },
+    { "png", "8bpp", HandlePngToGbaCommand },
+    { "png", "NCGR", HandlePngToNtrCommand },
+    { "png", "gbapal", HandlePngToGbaPaletteCommand },
+    { "png", "nbfp", HandlePngToGbaPaletteCommand },
+    { "png", "NCLR", HandlePngToNtrPaletteCommand },
+    { "gbapal", "pal", HandleGbaToJascPaletteCommand },
+    { "NCLR", "pal", HandleNtrToJascPaletteCommand },
+    { "NCPR", "pal", HandleNtrToJascPaletteCommand },
+    { "pal", "gbapal", HandleJascToGbaPaletteCommand },
+    { "pal", "NCLR", HandleJascToNtrPaletteCommand },
+    { "latfont", "png", HandleLatinFontToPngCommand },
+    { "png", "latfont", HandlePngToLatinFontCommand },
+    { "hwjpnfont", "png", HandleHalfwidthJapaneseFontToPngCommand },
+    { "png", "hwjpnfont", HandlePngToHalfwidthJapaneseFontCommand },
+    { "fwjpnfont", "png", HandleFullwidthJapaneseFontToPngCommand },
+    { "png", "fwjpnfont", HandlePngToFullwidthJapaneseFontCommand },
+    { "json", "NCER", HandleJsonToNtrCellCommand },
+    { "NCER", "json", HandleNtrCellToJsonCommand },
+    { "json", "NSCR", HandleJsonToNtrScreenCommand },
+    { "json", "NANR", HandleJsonToNtrAnimationCommand },
+    { "NANR", "json", HandleNtrAnimationToJsonCommand },
+    { "json", "NMAR", HandleJsonToNtrMulticellAnimationCommand },
+    { "NMAR", "json", HandleNtrAnimationToJsonCommand },
+    { NULL, "huff", HandleHuffCompressCommand },
+    { NULL, "lz", HandleLZCompressCommand },
+    { "huff", NULL, HandleHuffDecompressCommand },
+    { "lz", NULL, HandleLZDecompressCommand },
+    { NULL, "rl", HandleRLCompressCommand },
+    { "rl", NULL, HandleRLDecompressCommand },
+    { NULL, NULL, NULL }
+};
 
-    char *inputPath = argv[1];
-    char *outputPath = argv[2];
+static const struct CommandHandler *FindCommandHandler(char *inputPath, char *outputPath)
+{
     char *inputFileExtension = GetFileExtension(inputPath);
     char *outputFileExtension = GetFileExtension(outputPath);
 
@@ -1169,10 +1181,529 @@ int main(int argc, char **argv)
         if ((handlers[i].inputFileExtension == NULL || strcmp(handlers[i].inputFileExtension, inputFileExtension) == 0)
             && (handlers[i].outputFileExtension == NULL || strcmp(handlers[i].outputFileExtension, outputFileExtension) == 0))
         {
-            handlers[i].function(inputPath, outputPath, argc, argv);
-            return 0;
+            return &handlers[i];
         }
     }
 
     FATAL_ERROR("Don't know how to convert \"%s\" to \"%s\".\n", inputPath, outputPath);
 }
+
+// A batch job is one manifest line, tokenised into the same argv layout the
+// handlers expect from the command line: { "nitrogfx", INPUT, OUTPUT, options... }.
+struct BatchJob
+{
+    int argc;
+    char **argv;
+    const struct CommandHandler *handler;
+};
+
+struct BatchQueue
+{
+    struct BatchJob *jobs;
+    int numJobs;
+    int nextJob;
+    char *manifest;
+    pthread_mutex_t lock;
+};
+
+static char *ReadWholeStream(FILE *fp, const char *name)
+{
+    size_t capacity = 0x1000;
+    size_t size = 0;
+    char *buffer = malloc(capacity);
+
+    if (buffer == NULL)
+        FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", name);
+
+    for (;;)
+    {
+        if (size + 1 >= capacity)
+        {
+            capacity *= 2;
+            buffer = realloc(buffer, capacity);
+            if (buffer == NULL)
+                FATAL_ERROR("Failed to allocate memory for reading \"%s\".\n", name);
+        }
+
+        size_t count = fread(buffer + size, 1, capacity - size - 1, fp);
+
+        if (count == 0)
+            break;
+
+        size += count;
+    }
+
+    if (ferror(fp))
+        FATAL_ERROR("Failed to read \"%s\".\n", name);
+
+    buffer[size] = 0;
+
+    return buffer;
+}
+
+// Manifest format: one conversion per line, "INPUT_PATH OUTPUT_PATH [options...]",
+// separated by whitespace. Blank lines and lines starting with '#' are ignored.
+static struct BatchJob *ParseBatchManifest(char *manifestPath, int *numJobs, char **manifest)
+{
+    char *text;
+
+    if (strcmp(manifestPath, "-") == 0)
+    {
+        text = ReadWholeStream(stdin, "stdin");
+    }
+    else
+    {
+        FILE *fp = fopen(manifestPath, "rb");
+
+        if (fp == NULL)
+            FATAL_ERROR("Failed to open \"%s\" for reading.\n", manifestPath);
+
+        text = ReadWholeStream(fp, manifestPath);
+        fclose(fp);
+    }
+
+    int capacity = 64;
+    int count = 0;
+    struct BatchJob *jobs = malloc(capacity * sizeof(struct BatchJob));
+
+    if (jobs == NULL)
+        FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+
+    int lineNum = 0;
+    char *line = text;
+
+    while (*line != 0)
+    {
+        char *end = strchr(line, '\n');
+        char *next;
+
+        if (end != NULL)
+        {
+            *end = 0;
+            next = end + 1;
+        }
+        else
+        {
+            next = line + strlen(line);
+        }
+
+        lineNum++;
+
+        int numTokens = 0;
+        for (char *p = line; *p != 0;)
+        {
+            while (*p != 0 && isspace((unsigned char)*p))
+                p++;
+            if (*p == 0)
+                break;
+            numTokens++;
+            while (*p != 0 && !isspace((unsigned char)*p))
+                p++;
+        }
+
+        while (isspace((unsigned char)*line))
+            line++;
+
+        if (numTokens == 0 || *line == '#')
+        {
+            line = next;
+            continue;
+        }
+
+        if (numTokens < 2)
+            FATAL_ERROR("%s:%d: expected \"INPUT_PATH OUTPUT_PATH [options...]\".\n", manifestPath, lineNum);
+
+        if (count == capacity)
+        {
+            capacity *= 2;
+            jobs = realloc(jobs, capacity * sizeof(struct BatchJob));
+            if (jobs == NULL)
+                FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+        }
+
+        struct BatchJob *job = &jobs[count++];
+
+        job->argc = numTokens + 1;
+        job->argv = malloc((job->argc + 1) * sizeof(char *));
+
+        if (job->argv == NULL)
+            FATAL_ERROR("Failed to allocate memory for batch jobs.\n");
+
+        job->argv[0] = "nitrogfx";
+
+        int i = 1;
+        for (char *p = line; *p != 0;)
+        {
+            while (*p != 0 && isspace((unsigned char)*p))
+                *p++ = 0;
+            if (*p == 0)
+                break;
+            job->argv[i++] = p;
+            while (*p != 0 && !isspace((unsigned char)*p))
+                p++;
+        }
+        job->argv[i] = NULL;
+
+        // resolve handlers up front so a bad manifest fails before any work is done
+        job->handler = FindCommandHandler(job->argv[1], job->argv[2]);
+
+        line = next;
+    }
+
+    *numJobs = count;
+    *manifest = text;
+
+    return jobs;
+}
+
+static void *BatchWorker(void *arg)
+{
+    struct BatchQueue *queue = arg;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&queue->lock);
+        int index = queue->nextJob++;
+        pthread_mutex_unlock(&queue->lock);
+
+        if (index >= queue->numJobs)
+            break;
+
+        struct BatchJob *job = &queue->jobs[index];
+
+        job->handler->function(job->argv[1], job->argv[2], job->argc, job->argv);
+    }
+
+    return NULL;
+}
+
+static int GetDefaultNumThreads(void)
+{
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (numCpus < 1)
+        return 1;
+
+    return (int)numCpus;
+}
+
+// nitrogfx -batch MANIFEST [-j THREADS]
+// Runs every conversion listed in MANIFEST ("-" for stdin) in this process.
+// Any failing conversion aborts the whole batch with the usual error message.
+static void HandleBatchCommand(int argc, char **argv)
+{
+    char *manifestPath = argv[2];
+    int numThreads = GetDefaultNumThreads();
+
+    for (int i = 3; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-j") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No thread count following \"-j\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &numThreads))
+                FATAL_ERROR("Failed to parse thread count.\n");
+
+            if (numThreads < 1)
+                FATAL_ERROR("Thread count must be positive.\n");
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    struct BatchQueue queue;
+
+    queue.jobs = ParseBatchManifest(manifestPath, &queue.numJobs, &queue.manifest);
+    queue.nextJob = 0;
+    pthread_mutex_init(&queue.lock, NULL);
+
+    if (numThreads > queue.numJobs)
+        numThreads = queue.numJobs;
+
+    if (numThreads <= 1)
+    {
+        BatchWorker(&queue);
+    }
+    else
+    {
+        pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+
+        if (threads == NULL)
+            FATAL_ERROR("Failed to allocate memory for batch threads.\n");
+
+        for (int i = 0; i < numThreads; i++)
+        {
+            if (pthread_create(&threads[i], NULL, BatchWorker, &queue) != 0)
+                FATAL_ERROR("Failed to create batch worker thread.\n");
+        }
+
+        for (int i = 0; i < numThreads; i++)
+            pthread_join(threads[i], NULL);
+
+        free(threads);
+    }
+
+    pthread_mutex_destroy(&queue.lock);
+
+    for (int i = 0; i < queue.numJobs; i++)
+        free(queue.jobs[i].argv);
+
+    free(queue.jobs);
+    free(queue.manifest);
+}
+
+struct BenchCorpus
+{
+    char **paths;
+    int numFiles;
+    int capacity;
+};
+
+static void CollectBenchFiles(struct BenchCorpus *corpus, const char *dirPath)
+{
+    DIR *dir = opendir(dirPath);
+
+    if (dir == NULL)
+        FATAL_ERROR("Failed to open directory \"%s\".\n", dirPath);
+
+    struct dirent *entry;
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+
+        char *path = malloc(strlen(dirPath) + strlen(entry->d_name) + 2);
+
+        if (path == NULL)
+            FATAL_ERROR("Failed to allocate memory for the benchmark corpus.\n");
+
+        sprintf(path, "%s/%s", dirPath, entry->d_name);
+
+        struct stat st;
+
+        if (stat(path, &st) != 0 || (S_ISREG(st.st_mode) && st.st_size == 0))
+        {
+            free(path);
+        }
+        else if (S_ISDIR(st.st_mode))
+        {
+            CollectBenchFiles(corpus, path);
+            free(path);
+        }
+        else if (S_ISREG(st.st_mode))
+        {
+            if (corpus->numFiles == corpus->capacity)
+            {
+                corpus->capacity = corpus->capacity ? corpus->capacity * 2 : 64;
+                corpus->paths = realloc(corpus->paths, corpus->capacity * sizeof(char *));
+                if (corpus->paths == NULL)
+                    FATAL_ERROR("Failed to allocate memory for the benchmark corpus.\n");
+            }
+            corpus->paths[corpus->numFiles++] = path;
+        }
+        else
+        {
+            free(path);
+        }
+    }
+
+    closedir(dir);
+}
+
+static double GetSeconds(void)
+{
+    struct timespec ts;
+
+    timespec_get(&ts, TIME_UTC);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// HuffCompress cannot build a tree for single-symbol data and the decoder
+// only handles whole 32-bit words, so such files are left out of the Huff run.
+static bool CanHuffCompress(unsigned char *data, int size)
+{
+    if (size % 4 != 0)
+        return false;
+
+    for (int i = 0; i < size; i++)
+    {
+        if ((data[i] & 0xF) != (data[0] & 0xF) || (data[i] >> 4) != (data[0] & 0xF))
+            return true;
+    }
+
+    return false;
+}
+
+enum BenchCodec
+{
+    BENCH_LZ,
+    BENCH_RL,
+    BENCH_HUFF,
+    BENCH_NUM_CODECS
+};
+
+static unsigned char *BenchCompress(enum BenchCodec codec, unsigned char *data, int size, int *compressedSize)
+{
+    switch (codec)
+    {
+    case BENCH_LZ:
+        return LZCompress(data, size, compressedSize, 2);
+    case BENCH_RL:
+        return RLCompress(data, size, compressedSize);
+    default:
+        return HuffCompress(data, size, compressedSize, 4);
+    }
+}
+
+static unsigned char *BenchDecompress(enum BenchCodec codec, unsigned char *data, int size, int *uncompressedSize)
+{
+    switch (codec)
+    {
+    case BENCH_LZ:
+        return LZDecompress(data, size, uncompressedSize);
+    case BENCH_RL:
+        return RLDecompress(data, size, uncompressedSize);
+    default:
+        return HuffDecompress(data, size, uncompressedSize);
+    }
+}
+
+// nitrogfx -bench CORPUS_DIR [-iterations N]
+// Compresses every file under CORPUS_DIR with each codec, then reports the
+// compression and decompression throughput in MB/s of uncompressed data.
+static void HandleBenchCommand(int argc, char **argv)
+{
+    static const char *codecNames[BENCH_NUM_CODECS] = { "lz", "rl", "huff" };
+    int iterations = 10;
+
+    for (int i = 3; i < argc; i++)
+    {
+        char *option = argv[i];
+
+        if (strcmp(option, "-iterations") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("No count following \"-iterations\".\n");
+
+            i++;
+
+            if (!ParseNumber(argv[i], NULL, 10, &iterations))
+                FATAL_ERROR("Failed to parse iteration count.\n");
+
+            if (iterations < 1)
+                FATAL_ERROR("Iteration count must be positive.\n");
+        }
+        else
+        {
+            FATAL_ERROR("Unrecognized option \"%s\".\n", option);
+        }
+    }
+
+    struct BenchCorpus corpus = { NULL, 0, 0 };
+
+    CollectBenchFiles(&corpus, argv[2]);
+
+    if (corpus.numFiles == 0)
+        FATAL_ERROR("No files found in \"%s\".\n", argv[2]);
+
+    printf("%-6s %8s %12s %12s %14s %16s\n", "codec", "files", "raw bytes", "comp bytes", "compress MB/s", "decompress MB/s");
+
+    for (int codec = 0; codec < BENCH_NUM_CODECS; codec++)
+    {
+        int numFiles = 0;
+        double rawBytes = 0;
+        double compressedBytes = 0;
+        double compressTime = 0;
+        double decompressTime = 0;
+
+        for (int i = 0; i < corpus.numFiles; i++)
+        {
+            int size;
+            unsigned char *data = ReadWholeFile(corpus.paths[i], &size);
+
+            if (codec == BENCH_HUFF && !CanHuffCompress(data, size))
+            {
+                free(data);
+                continue;
+            }
+
+            int compressedSize;
+            double start = GetSeconds();
+            unsigned char *compressed = BenchCompress(codec, data, size, &compressedSize);
+            compressTime += GetSeconds() - start;
+
+            int uncompressedSize;
+            unsigned char *uncompressed = BenchDecompress(codec, compressed, compressedSize, &uncompressedSize);
+            bool roundTrips = uncompressedSize == size && memcmp(uncompressed, data, size) == 0;
+
+            free(uncompressed);
+
+            if (!roundTrips)
+            {
+                fprintf(stderr, "%s round trip mismatch for \"%s\", skipping.\n", codecNames[codec], corpus.paths[i]);
+                free(compressed);
+                free(data);
+                continue;
+            }
+
+            start = GetSeconds();
+            for (int j = 0; j < iterations; j++)
+                free(BenchDecompress(codec, compressed, compressedSize, &uncompressedSize));
+            decompressTime += GetSeconds() - start;
+
+            numFiles++;
+            rawBytes += size;
+            compressedBytes += compressedSize;
+
+            free(compressed);
+            free(data);
+        }
+
+        double megabytes = rawBytes / (1024 * 1024);
+
+        printf("%-6s %8d %12.0f %12.0f %14.2f %16.2f\n", codecNames[codec], numFiles, rawBytes, compressedBytes,
+               compressTime > 0 ? megabytes / compressTime : 0,
+               decompressTime > 0 ? megabytes * iterations / decompressTime : 0);
+    }
+
+    for (int i = 0; i < corpus.numFiles; i++)
+        free(corpus.paths[i]);
+
+    free(corpus.paths);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        FATAL_ERROR("Usage: nitrogfx INPUT_PATH OUTPUT_PATH [options...]\n"
+                    "       nitrogfx -batch MANIFEST_PATH [-j THREADS]\n"
+                    "       nitrogfx -bench CORPUS_DIR [-iterations N]\n");
+
+    if (strcmp(argv[1], "-batch") == 0)
+    {
+        HandleBatchCommand(argc, argv);
+        return 0;
+    }
+
+    if (strcmp(argv[1], "-bench") == 0)
+    {
+        HandleBenchCommand(argc, argv);
+        return 0;
+    }
+
+    char *inputPath = argv[1];
+    char *outputPath = argv[2];
+
+    FindCommandHandler(inputPath, outputPath)->function(inputPath, outputPath, argc, argv);
+
+    return 0;
+}
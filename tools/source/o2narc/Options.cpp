@@ -3,7 +3,7 @@
 #include <cstring>
 #include <algorithm>
 #include "Options.h"
-#include "Narc.h"
+#include "NarcFormat.h"
 #include "RelocElfReader.h"
 
 Options::Options(int argc, char **argv) {
@@ -30,41 +30,39 @@ Options::Options(int argc, char **argv) {
     if (posargs.size() < 2) {
         throw command_error("missing positional arg");
     }
-    objfile.open(posargs[0], ios::in | ios::binary);
+    objfile.open(posargs[0]);
     narcfile.open(posargs[1], ios::out | ios::binary);
 }
 
 void Options::ReadObjectFile(vector<unsigned char> &rodata, vector<uint32_t> &sizes) {
     ELF_ASSERT(objfile.HasSection(".rodata"));
-    rodata.resize(objfile.GetSectionHeader(".rodata").sh_size);
-    objfile.ReadSectionData(objfile.GetSectionHeader(".rodata"), rodata.data());
+    const Elf32_Shdr &rodatasec = objfile.GetSectionHeader(".rodata");
+    rodata.resize(rodatasec.sh_size);
+    objfile.ReadSectionData(rodatasec, rodata.data());
     // Determine what O file we're dealing with
     if (objfile.HasSymbol("__size")) {
-        uint32_t size = objfile.GetSymbol("__size").st_size;
+        const Elf32_Sym &sizesym = objfile.GetSymbol("__size");
+        uint32_t size = sizesym.st_size;
         if (size == sizeof(uint32_t)) {
-            objfile.ReadSymbolData(objfile.GetSymbol("__size"), &size);
+            objfile.ReadSymbolData(sizesym, &size);
             sizes.resize((rodata.size() + size - 1) / size);
             fill(sizes.begin(), sizes.end(), size);
         } else {
-            sizes.resize(objfile.GetSymbol("__size").st_size / sizeof(uint32_t));
-            objfile.ReadSymbolData(objfile.GetSymbol("__size"), sizes.data());
+            sizes.resize(sizesym.st_size / sizeof(uint32_t));
+            objfile.ReadSymbolData(sizesym, sizes.data());
         }
     } else {
-        auto pred = [&](const Elf32_Sym &sym) {
-            return sym.st_size != 0
-                   && strcmp(objfile.GetSectionName(objfile.sections()[sym.st_shndx]), ".rodata") == 0
-                   && strcmp(objfile.GetSymbolName(sym), "__size") != 0
-                   && strcmp(objfile.GetSymbolName(sym), "__data") != 0
-                   && strcmp(objfile.GetSymbolName(sym), ".rodata") != 0;
-        };
-        sizes.resize(count_if(objfile.symbols().begin(), objfile.symbols().end(), pred));
-        ELF_ASSERT(!sizes.empty());
-        int t = 0;
+        size_t rodataidx = objfile.GetSectionIndex(".rodata");
         for (const auto &sym : objfile.symbols()) {
-            if (pred(sym)) {
-                sizes[t++] = sym.st_size;
+            if (sym.st_size == 0 || sym.st_shndx != rodataidx) {
+                continue;
+            }
+            string_view name = objfile.GetSymbolName(sym);
+            if (name != "__size" && name != "__data" && name != ".rodata") {
+                sizes.push_back(sym.st_size);
             }
         }
+        ELF_ASSERT(!sizes.empty());
     }
 }
 
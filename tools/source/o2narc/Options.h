@@ -1,6 +1,7 @@
 #ifndef GUARD_OPTIONS_H
 #define GUARD_OPTIONS_H
 
+#include <fstream>
 #include <string>
 #include "RelocElfReader.h"
 
@@ -1,68 +1,127 @@
 #include <cstring>
 #include <algorithm>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 #include "RelocElfReader.h"
 
-Elf::Elf(const string &filename, ios::openmode openmode) {
-    open(filename, openmode);
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+Elf::Elf(const string &filename) {
+    open(filename);
 }
 
-void Elf::open(const string &filename, ios::openmode openmode) {
-    handle.open(filename, openmode);
-    ELF_ASSERT(handle.good());
-    handle.read((char *)&ehdr, sizeof(Elf32_Ehdr));
+void Elf::open(const string &filename) {
+    close();
+    int fd = ::open(filename.c_str(), O_RDONLY | O_BINARY);
+    ELF_ASSERT(fd >= 0);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Elf32_Ehdr)) {
+        ::close(fd);
+        throw elf_exception("ELF_ASSERT(file is large enough for an ELF header) failed");
+    }
+    size = st.st_size;
+#ifdef _WIN32
+    buffer.resize(size);
+    for (size_t total = 0; total < size;) {
+        auto nread = read(fd, buffer.data() + total, size - total);
+        if (nread <= 0) {
+            ::close(fd);
+            throw elf_exception("ELF_ASSERT(read(fd) > 0) failed");
+        }
+        total += nread;
+    }
+    data = buffer.data();
+#else
+    void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    ELF_ASSERT(map != MAP_FAILED);
+    data = static_cast<const unsigned char *>(map);
+#endif
+
+    memcpy(&ehdr, data, sizeof(Elf32_Ehdr));
     ELF_ASSERT(memcmp(ehdr.e_ident, ELFMAG, SELFMAG) == 0);
     ELF_ASSERT(ehdr.e_ident[EI_CLASS] == ELFCLASS32);
     ELF_ASSERT(ehdr.e_ident[EI_DATA] == ELFDATA2LSB);
     ELF_ASSERT(ehdr.e_ident[EI_VERSION] == EV_CURRENT);
     ELF_ASSERT(ehdr.e_ehsize == sizeof(Elf32_Ehdr));
     shdr.resize(ehdr.e_shnum);
-    handle.seekg(ehdr.e_shoff);
-    handle.read((char *)shdr.data(), static_cast<streamsize>(ehdr.e_shnum * sizeof(Elf32_Shdr)));
+    memcpy(shdr.data(), GetData(ehdr.e_shoff, ehdr.e_shnum * sizeof(Elf32_Shdr)), ehdr.e_shnum * sizeof(Elf32_Shdr));
     for (const auto & sec : shdr) {
         switch (sec.sh_type) {
         case SHT_STRTAB: {
-            char *&_strtab = (&sec - shdr.data() == ehdr.e_shstrndx) ? shstrtab : strtab;
+            const char *&_strtab = (&sec - shdr.data() == ehdr.e_shstrndx) ? shstrtab : strtab;
             ELF_ASSERT(_strtab == nullptr);
-            _strtab = new char[sec.sh_size];
-            handle.seekg(sec.sh_offset);
-            handle.read(_strtab, sec.sh_size);
+            ELF_ASSERT(sec.sh_size != 0);
+            _strtab = (const char *)GetData(sec.sh_offset, sec.sh_size);
+            // Names are read as C strings, so the table has to end in a terminator.
+            ELF_ASSERT(_strtab[sec.sh_size - 1] == '\0');
             break;
         }
         case SHT_SYMTAB:
             ELF_ASSERT(sym.empty());
             sym.resize(sec.sh_size / sizeof(Elf32_Sym));
-            handle.seekg(sec.sh_offset);
-            handle.read((char *)sym.data(), sec.sh_size);
+            memcpy(sym.data(), GetData(sec.sh_offset, sym.size() * sizeof(Elf32_Sym)), sym.size() * sizeof(Elf32_Sym));
             break;
         }
     }
+
+    // emplace keeps the first entry for a repeated name, which is the one the
+    // old linear scans returned.
+    if (shstrtab != nullptr) {
+        sectionIndex.reserve(shdr.size());
+        for (size_t i = 0; i < shdr.size(); i++) {
+            sectionIndex.emplace(GetSectionName(shdr[i]), i);
+        }
+    }
+    if (strtab != nullptr) {
+        symbolIndex.reserve(sym.size());
+        for (size_t i = 0; i < sym.size(); i++) {
+            symbolIndex.emplace(GetSymbolName(sym[i]), i);
+        }
+    }
 }
 
-Elf::~Elf() {
-    delete[] strtab;
-    delete[] shstrtab;
+void Elf::close() {
+#ifndef _WIN32
+    if (data != nullptr) {
+        munmap(const_cast<unsigned char *>(data), size);
+    }
+#endif
+    data = nullptr;
+    size = 0;
+    buffer.clear();
+    shdr.clear();
+    sym.clear();
+    strtab = nullptr;
+    shstrtab = nullptr;
+    sectionIndex.clear();
+    symbolIndex.clear();
 }
 
-Elf32_Shdr &Elf::GetSectionHeader(const char *name) {
-    return *find_if(shdr.begin(), shdr.end(), [=](const Elf32_Shdr &sec) {
-        return strcmp(shstrtab + sec.sh_name, name) == 0;
-    } );
+Elf::~Elf() {
+    close();
 }
 
-bool Elf::HasSection(const char *name) {
-    return any_of(shdr.begin(), shdr.end(), [=](const Elf32_Shdr &sec) {
-        return strcmp(shstrtab + sec.sh_name, name) == 0;
-    } );
+Elf32_Shdr &Elf::GetSectionHeader(string_view name) {
+    return shdr[GetSectionIndex(name)];
 }
 
-Elf32_Sym &Elf::GetSymbol(const char *name) {
-    return *find_if(sym.begin(), sym.end(), [=](const Elf32_Sym &symbol) {
-        return strcmp(strtab + symbol.st_name, name) == 0;
-    });
+size_t Elf::GetSectionIndex(string_view name) {
+    auto it = sectionIndex.find(name);
+    ELF_ASSERT(it != sectionIndex.end());
+    return it->second;
 }
 
-bool Elf::HasSymbol(const char *name) {
-    return any_of(sym.begin(), sym.end(), [=](const Elf32_Sym &symbol) {
-        return strcmp(strtab + symbol.st_name, name) == 0;
-    });
+Elf32_Sym &Elf::GetSymbol(string_view name) {
+    auto it = symbolIndex.find(name);
+    ELF_ASSERT(it != symbolIndex.end());
+    return sym[it->second];
 }
@@ -1,8 +1,11 @@
 #ifndef GUARD_RELOCELFREADER_H
 #define GUARD_RELOCELFREADER_H
 
-#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
+#include <cstring>
 #include "elf.h"
 
 using namespace std;
@@ -19,28 +22,39 @@ public:
 #define ELF_ASSERT(expr) do {if(!(expr)) {throw elf_exception("ELF_ASSERT(" #expr ") failed");}} while (0)
 
 class Elf {
-    fstream handle;
+    // The object file is mapped read-only; strtab and shstrtab point into it.
+    const unsigned char *data = nullptr;
+    size_t size = 0;
+    vector<unsigned char> buffer;
     Elf32_Ehdr ehdr {};
     vector<Elf32_Shdr> shdr;
     vector<Elf32_Sym> sym;
-    char *strtab = nullptr;
-    char *shstrtab = nullptr;
+    const char *strtab = nullptr;
+    const char *shstrtab = nullptr;
+    // Name -> index of the first section/symbol with that name, built at open().
+    unordered_map<string_view, size_t> sectionIndex;
+    unordered_map<string_view, size_t> symbolIndex;
+
+    void close();
+    const unsigned char *GetData(size_t offset, size_t length) const {
+        ELF_ASSERT(offset <= size && length <= size - offset);
+        return data + offset;
+    }
 public:
     Elf() = default;
-    explicit Elf(const string &filename, ios::openmode openmode = ios::in | ios::binary);
-    void open(const string &filename, ios::openmode openmode = ios::in | ios::binary);
+    explicit Elf(const string &filename);
+    void open(const string &filename);
     ~Elf();
+    Elf(const Elf &) = delete;
+    Elf &operator=(const Elf &) = delete;
     bool is_open() const {
-        return handle.is_open();
+        return data != nullptr;
     }
-    Elf32_Shdr &GetSectionHeader(const char *name);
-    Elf32_Shdr &GetSectionHeader(const string &name) { return GetSectionHeader(name.c_str()); }
-    bool HasSection(const char *name);
-    bool HasSection(const string &name) { return HasSection(name.c_str()); }
-    Elf32_Sym &GetSymbol(const char *name);
-    Elf32_Sym &GetSymbol(const string &name) { return GetSymbol(name.c_str()); }
-    bool HasSymbol(const char *name);
-    bool HasSymbol(const string &name) { return HasSymbol(name.c_str()); }
+    Elf32_Shdr &GetSectionHeader(string_view name);
+    bool HasSection(string_view name) const { return sectionIndex.count(name) != 0; }
+    size_t GetSectionIndex(string_view name);
+    Elf32_Sym &GetSymbol(string_view name);
+    bool HasSymbol(string_view name) const { return symbolIndex.count(name) != 0; }
     template <typename T>
     T *ReadSectionData(const Elf32_Shdr &sec, T *dest = nullptr) {
         if (dest == nullptr) {
@@ -49,8 +63,7 @@ public:
             }
             dest = new T[sec.sh_size];
         }
-        handle.seekg(sec.sh_offset);
-        handle.read((char *)dest, sec.sh_size);
+        memcpy(dest, GetData(sec.sh_offset, sec.sh_size), sec.sh_size);
         return dest;
     }
 
@@ -62,8 +75,8 @@ public:
             }
             dest = new T[symbol.st_size];
         }
-        handle.seekg(symbol.st_value - shdr[symbol.st_shndx].sh_addr + shdr[symbol.st_shndx].sh_offset);
-        handle.read((char *)dest, symbol.st_size);
+        ELF_ASSERT(symbol.st_shndx < shdr.size());
+        memcpy(dest, GetData(symbol.st_value - shdr[symbol.st_shndx].sh_addr + shdr[symbol.st_shndx].sh_offset, symbol.st_size), symbol.st_size);
         return dest;
     }
 
@@ -4,7 +4,7 @@
 #include <vector>
 #include <algorithm>
 #include "RelocElfReader.h"
-#include "Narc.h"
+#include "NarcFormat.h"
 #include "Options.h"
 
 using namespace std;
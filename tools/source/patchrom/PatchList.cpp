@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include "PatchList.h"
+
+static vector<string> SplitWords(const string &line) {
+    vector<string> words;
+    istringstream stream(line);
+    string word;
+    while (stream >> word) {
+        words.push_back(word);
+    }
+    return words;
+}
+
+static string Trim(const string &line) {
+    size_t begin = line.find_first_not_of(" \t\r\n");
+    if (begin == string::npos) {
+        return "";
+    }
+    size_t end = line.find_last_not_of(" \t\r\n");
+    return line.substr(begin, end - begin + 1);
+}
+
+static void ReadDefines(const string &line, map<string, string> &defines) {
+    size_t open = line.find('"');
+    size_t close = line.find('"', open + 1);
+    string path = Trim(line.substr(open + 1, close == string::npos ? string::npos : close - open - 1));
+    ifstream file(path);
+    if (!file.good()) {
+        cout << "Error including file on line \"" << Trim(line) << "\"." << endl;
+        return;
+    }
+    string define;
+    while (getline(file, define)) {
+        if (define.compare(0, 8, "#define ") != 0) {
+            continue;
+        }
+        vector<string> words = SplitWords(define);
+        if (words.size() < 2) {
+            cout << "Error reading define on line\"" << Trim(define) << "\" in file \"" << path << "\"." << endl;
+            continue;
+        }
+        if (words.size() == 2 || words[2].compare(0, 2, "//") == 0 || words[2].compare(0, 2, "/*") == 0) {
+            defines[words[1]] = "";
+        } else {
+            defines[words[1]] = words[2];
+        }
+    }
+}
+
+PatchList PatchList::Read(const string &filename) {
+    PatchList list;
+    list.filename = filename;
+    ifstream file(filename);
+    if (!file.good()) {
+        return list;
+    }
+
+    // Innermost condition first: the name and whether it has to be defined.
+    vector<pair<string, bool>> conditionals;
+    string line;
+    int lineno = 0;
+    while (getline(file, line)) {
+        lineno++;
+        if (line.compare(0, 10, "#include \"") == 0) {
+            ReadDefines(line, list.defines);
+            continue;
+        }
+
+        string trimmed = Trim(line);
+        string upper = trimmed;
+        transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return toupper(c); });
+        vector<string> words = SplitWords(trimmed);
+        if (upper.compare(0, 7, "#IFDEF ") == 0 && words.size() > 1) {
+            conditionals.insert(conditionals.begin(), {words[1], true});
+            continue;
+        } else if (upper.compare(0, 8, "#IFNDEF ") == 0 && words.size() > 1) {
+            conditionals.insert(conditionals.begin(), {words[1], false});
+            continue;
+        } else if (upper == "#ELSE" && !conditionals.empty()) {
+            conditionals.front().second = !conditionals.front().second;
+            continue;
+        } else if (upper == "#ENDIF") {
+            if (conditionals.empty()) {
+                throw runtime_error(filename + ":" + to_string(lineno) + ": #endif without #ifdef");
+            }
+            conditionals.erase(conditionals.begin());
+            continue;
+        }
+
+        bool skip = any_of(conditionals.begin(), conditionals.end(), [&](const pair<string, bool> &condition) {
+            return (list.defines.count(condition.first) != 0) != condition.second;
+        });
+        if (skip || trimmed.empty() || trimmed[0] == '#') {
+            continue;
+        }
+        list.lines.push_back({lineno, line});
+    }
+    return list;
+}
@@ -0,0 +1,30 @@
+#ifndef GUARD_PATCHLIST_H
+#define GUARD_PATCHLIST_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct PatchLine {
+    int lineno;
+    string text;
+};
+
+// One of the hooks/armhooks/repoints/routinepointers/bytereplacement lists
+// after the same preprocessing scripts/make.py did:
+//   #include "file"  pulls in that file's #define lines (one level only)
+//   #ifdef/#ifndef/#else/#endif  skip lines on whether a name was defined
+//   other lines starting with # and blank lines are comments
+struct PatchList {
+    string filename;
+    vector<PatchLine> lines;
+    // A define without a value maps to the empty string.
+    map<string, string> defines;
+
+    // A missing list is not an error and reads as empty.
+    static PatchList Read(const string &filename);
+};
+
+#endif //GUARD_PATCHLIST_H
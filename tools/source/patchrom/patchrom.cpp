@@ -0,0 +1,452 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "PatchList.h"
+#include "RelocElfReader.h"
+
+using namespace std;
+
+class command_error : public runtime_error {
+public:
+    explicit command_error(const string &s) : runtime_error(s) {}
+};
+
+// The lists in the order scripts/make.py used to apply them; where two
+// patches touch the same byte, the later one wins.
+enum PatchKind {
+    BYTE_REPLACEMENT,
+    THUMB_HOOK,
+    ARM_HOOK,
+    ROUTINE_POINTER,
+    REPOINT,
+    NUM_PATCH_KINDS
+};
+
+static const char *const sListNames[NUM_PATCH_KINDS] = {
+    "bytereplacement",
+    "hooks",
+    "armhooks",
+    "routinepointers",
+    "repoints",
+};
+
+struct Patch {
+    string target;   // "arm9" or the four-digit overlay number
+    uint32_t offset;
+    vector<unsigned char> bytes;
+    string origin;   // list:line, for diagnostics
+};
+
+struct TargetFile {
+    string path;
+    vector<const Patch *> patches;
+};
+
+static inline void usage() {
+    cout << "Usage: patchrom [options] ELF..." << endl;
+    cout << endl;
+    cout << "Applies bytereplacement, hooks, armhooks, routinepointers and repoints" << endl;
+    cout << "to arm9.bin and the overlays, resolving symbols from the linked ELFs." << endl;
+    cout << endl;
+    cout << "Options:" << endl;
+    cout << "\t-b DIR\tDirectory with arm9.bin, overarm9.bin and overlay/ (default: base)" << endl;
+    cout << "\t-l DIR\tDirectory with the patch lists (default: .)" << endl;
+    cout << "\t-s FILE\tWrite the symbol table to FILE (default: offsets.ini)" << endl;
+    cout << "\t-j N\tPatch up to N files at once (default: number of CPUs)" << endl;
+    cout << "\t-Werror\tTreat overlapping patches as an error" << endl;
+}
+
+// Collects what `nm` listed as t/T/d/D: symbols in allocated code or
+// initialized writable data, with the Thumb bit cleared from functions and
+// the ARM mapping symbols ($a, $t, $d) left out. A global wins over a local
+// of the same name; later files win over earlier ones.
+static void ReadSymbols(const string &filename, map<string, uint32_t> &table) {
+    Elf elf(filename);
+    map<string, pair<uint32_t, bool>> symbols;
+    for (const auto &sym : elf.symbols()) {
+        int type = ELF32_ST_TYPE(sym.st_info);
+        if (sym.st_shndx == SHN_UNDEF || sym.st_shndx >= SHN_LORESERVE || sym.st_shndx >= elf.sections().size()
+            || type == STT_SECTION || type == STT_FILE) {
+            continue;
+        }
+        const Elf32_Shdr &sec = elf.sections()[sym.st_shndx];
+        bool code = (sec.sh_flags & SHF_ALLOC) && (sec.sh_flags & SHF_EXECINSTR);
+        bool data = (sec.sh_flags & SHF_ALLOC) && (sec.sh_flags & SHF_WRITE) && sec.sh_type != SHT_NOBITS;
+        const char *name = elf.GetSymbolName(sym);
+        if ((!code && !data) || name[0] == '\0' || name[0] == '$') {
+            continue;
+        }
+        uint32_t value = sym.st_value;
+        if (type == STT_FUNC) {
+            value &= ~1u;
+        }
+        bool global = ELF32_ST_BIND(sym.st_info) != STB_LOCAL;
+        auto it = symbols.find(name);
+        if (it == symbols.end() || global || !it->second.second) {
+            symbols[name] = {value, global};
+        }
+    }
+    for (const auto &symbol : symbols) {
+        table[symbol.first] = symbol.second.first;
+    }
+}
+
+static void WriteSymbols(const string &filename, const map<string, uint32_t> &table) {
+    size_t width = 0;
+    for (const auto &symbol : table) {
+        width = max(width, symbol.first.size() + 1);
+    }
+    ofstream file(filename);
+    if (!file.good()) {
+        throw runtime_error("Unable to open file \"" + filename + "\" for writing");
+    }
+    for (const auto &symbol : table) {
+        file << left << setw(width) << (symbol.first + ":") << " "
+             << right << hex << uppercase << setw(8) << setfill('0') << symbol.second
+             << dec << setfill(' ') << "\n";
+    }
+}
+
+static vector<unsigned char> ReadFile(const string &filename) {
+    ifstream file(filename, ios::binary | ios::ate);
+    if (!file.good()) {
+        throw runtime_error("Unable to open file \"" + filename + "\" for reading");
+    }
+    vector<unsigned char> data(file.tellg());
+    file.seekg(0);
+    file.read((char *)data.data(), data.size());
+    return data;
+}
+
+static void WriteFile(const string &filename, const vector<unsigned char> &data) {
+    ofstream file(filename, ios::binary | ios::trunc);
+    file.write((const char *)data.data(), data.size());
+    if (!file.good()) {
+        throw runtime_error("Unable to write file \"" + filename + "\"");
+    }
+}
+
+static void AppendLE32(vector<unsigned char> &bytes, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        bytes.push_back(value >> (8 * i));
+    }
+}
+
+class PatchBuilder {
+    const vector<unsigned char> &y9;
+    const map<string, uint32_t> &symbols;
+public:
+    vector<Patch> patches;
+
+    PatchBuilder(const vector<unsigned char> &y9, const map<string, uint32_t> &symbols) : y9(y9), symbols(symbols) {}
+
+    // Addresses with 0x02000000 set are RAM addresses; anything else is a
+    // file offset written as 0x08000000 + offset.
+    uint32_t FileOffset(const string &target, uint32_t address) const {
+        if (!(address & 0x02000000)) {
+            return address - 0x08000000;
+        }
+        if (target == "arm9") {
+            return address - 0x02000000;
+        }
+        size_t entry = stoul(target) * 0x20 + 4;
+        if (entry + 4 > y9.size()) {
+            throw runtime_error("overlay " + target + " is not in overarm9.bin");
+        }
+        uint32_t ramAddress;
+        memcpy(&ramAddress, &y9[entry], 4);
+        return address - ramAddress;
+    }
+
+    bool LookUp(const string &symbol, uint32_t &value) const {
+        auto it = symbols.find(symbol);
+        if (it == symbols.end()) {
+            cout << "Symbol missing: " << symbol << endl;
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    void Add(PatchKind kind, const PatchList &list, const PatchLine &line);
+};
+
+static vector<string> SplitWords(const string &line) {
+    vector<string> words;
+    istringstream stream(line);
+    string word;
+    while (stream >> word) {
+        words.push_back(word);
+    }
+    return words;
+}
+
+static bool ParseHexByte(const string &word, unsigned char &value) {
+    if (word.empty() || word.size() > 2 || !all_of(word.begin(), word.end(), ::isxdigit)) {
+        return false;
+    }
+    value = stoul(word, nullptr, 16);
+    return true;
+}
+
+void PatchBuilder::Add(PatchKind kind, const PatchList &list, const PatchLine &line) {
+    string origin = list.filename + ":" + to_string(line.lineno);
+    vector<string> words = SplitWords(line.text);
+    Patch patch;
+    patch.origin = origin;
+    try {
+        if (kind == BYTE_REPLACEMENT) {
+            // TARGET ADDRESS BYTE... or TARGET ADDRESS DEFINE
+            if (words.size() < 3) {
+                throw runtime_error("expected TARGET ADDRESS BYTES");
+            }
+            patch.target = words[0];
+            patch.offset = FileOffset(patch.target, stoul(words[1], nullptr, 16));
+            bool literal = true;
+            for (size_t i = 2; i < words.size() && literal; i++) {
+                unsigned char value;
+                literal = ParseHexByte(words[i], value);
+                patch.bytes.push_back(value);
+            }
+            if (!literal) {
+                // The remainder names a define; emit its value little-endian in
+                // as few bytes as hold it.
+                string name = line.text.substr(line.text.find(words[2]));
+                name = name.substr(0, name.find_last_not_of(" \t\r\n") + 1);
+                auto define = list.defines.find(name);
+                if (define == list.defines.end()) {
+                    throw runtime_error("\"" + name + "\" is neither hex bytes nor a define");
+                }
+                uint32_t value;
+                if (define->second.empty()) {
+                    value = 1;
+                } else if (all_of(define->second.begin(), define->second.end(), ::isdigit)) {
+                    value = stoul(define->second);
+                } else {
+                    value = stoul(define->second, nullptr, 16);
+                }
+                patch.bytes.clear();
+                do {
+                    patch.bytes.push_back(value & 0xFF);
+                    value >>= 8;
+                } while (value != 0);
+            }
+        } else if (kind == THUMB_HOOK || kind == ARM_HOOK) {
+            // TARGET SYMBOL ADDRESS REGISTER
+            if (words.size() != 4) {
+                throw runtime_error("expected TARGET SYMBOL ADDRESS REGISTER");
+            }
+            uint32_t code;
+            if (!LookUp(words[1], code)) {
+                return;
+            }
+            patch.target = words[0];
+            patch.offset = FileOffset(patch.target, stoul(words[2], nullptr, 16));
+            int reg = stoi(words[3]);
+            if (kind == THUMB_HOOK) {
+                // ldr rN, [pc, #0]; bx rN; .word code+1 (padded with a nop
+                // first when needed to keep the literal word aligned)
+                patch.offset &= ~1u;
+                if (reg > 7) {
+                    cout << "Register used to hook at " << code << " is > 7 (r" << reg << " used).  Modulo'd by 8." << endl;
+                }
+                reg &= 7;
+                if (patch.offset % 4) {
+                    patch.bytes = {0x01, (unsigned char)(0x48 | reg), (unsigned char)(reg << 3), 0x47, 0x00, 0x00};
+                } else {
+                    patch.bytes = {0x00, (unsigned char)(0x48 | reg), (unsigned char)(reg << 3), 0x47};
+                }
+                AppendLE32(patch.bytes, code + 1);
+            } else {
+                // ldr rN, [pc, #0]; bx rN; .word code
+                patch.offset &= ~3u;
+                if (reg > 12) {
+                    cout << "Register used to hook at " << code << " is > 12 (r" << reg << " used).  Results may be unstable." << endl;
+                }
+                patch.bytes = {0x00, (unsigned char)(reg << 4), 0x9F, 0xE5, (unsigned char)(0x10 | reg), 0xFF, 0x2F, 0xE1};
+                AppendLE32(patch.bytes, code);
+            }
+        } else {
+            // TARGET SYMBOL[+HEXOFFSET] ADDRESS
+            if (words.size() != 3) {
+                throw runtime_error("expected TARGET SYMBOL ADDRESS");
+            }
+            string symbol = words[1];
+            uint32_t slide = kind == ROUTINE_POINTER ? 1 : 0;
+            size_t plus = symbol.find('+');
+            if (kind == REPOINT && plus != string::npos) {
+                slide = stoul(symbol.substr(plus + 1), nullptr, 16);
+                symbol.erase(plus);
+            }
+            uint32_t code;
+            if (!LookUp(symbol, code)) {
+                return;
+            }
+            patch.target = words[0];
+            patch.offset = FileOffset(patch.target, stoul(words[2], nullptr, 16));
+            AppendLE32(patch.bytes, code + slide);
+        }
+    } catch (const logic_error &) {
+        throw runtime_error(origin + ": malformed line \"" + line.text + "\"");
+    } catch (const runtime_error &e) {
+        throw runtime_error(origin + ": " + e.what());
+    }
+    patches.push_back(move(patch));
+}
+
+// Reports every pair of patches that write the same bytes of one file.
+static size_t ReportOverlaps(const string &path, const vector<const Patch *> &patches) {
+    vector<const Patch *> sorted(patches);
+    stable_sort(sorted.begin(), sorted.end(), [](const Patch *a, const Patch *b) { return a->offset < b->offset; });
+    size_t overlaps = 0;
+    const Patch *furthest = nullptr;
+    for (const Patch *patch : sorted) {
+        if (furthest != nullptr && patch->offset < furthest->offset + furthest->bytes.size()) {
+            cerr << path << ": " << patch->origin << " (0x" << hex << patch->offset
+                 << "-0x" << patch->offset + patch->bytes.size() << ") overlaps " << furthest->origin
+                 << " (0x" << furthest->offset << "-0x" << furthest->offset + furthest->bytes.size() << ")" << dec << endl;
+            overlaps++;
+        }
+        if (furthest == nullptr || patch->offset + patch->bytes.size() > furthest->offset + furthest->bytes.size()) {
+            furthest = patch;
+        }
+    }
+    return overlaps;
+}
+
+static void ApplyPatches(const TargetFile &file) {
+    vector<unsigned char> data = ReadFile(file.path);
+    for (const Patch *patch : file.patches) {
+        if (patch->offset + patch->bytes.size() > data.size()) {
+            data.resize(patch->offset + patch->bytes.size(), 0);
+        }
+        copy(patch->bytes.begin(), patch->bytes.end(), data.begin() + patch->offset);
+    }
+    WriteFile(file.path, data);
+}
+
+int main(int argc, char **argv) {
+    try {
+        string basedir = "base";
+        string listdir = ".";
+        string symfile = "offsets.ini";
+        unsigned numThreads = max(1u, thread::hardware_concurrency());
+        bool werror = false;
+        vector<string> elfs;
+        for (int i = 1; i < argc; i++) {
+            string arg{argv[i]};
+            auto value = [&]() -> string {
+                if (++i == argc) {
+                    throw command_error("missing argument for " + arg);
+                }
+                return argv[i];
+            };
+            if (arg == "-b") {
+                basedir = value();
+            } else if (arg == "-l") {
+                listdir = value();
+            } else if (arg == "-s") {
+                symfile = value();
+            } else if (arg == "-j") {
+                int n = stoi(value());
+                if (n < 1) {
+                    throw command_error("thread count must be positive");
+                }
+                numThreads = n;
+            } else if (arg == "-Werror") {
+                werror = true;
+            } else if (arg[0] == '-') {
+                throw command_error("unrecognized option flag: " + arg);
+            } else {
+                elfs.push_back(arg);
+            }
+        }
+        if (elfs.empty()) {
+            throw command_error("missing ELF files");
+        }
+
+        map<string, uint32_t> symbols;
+        for (const auto &elf : elfs) {
+            ReadSymbols(elf, symbols);
+        }
+        WriteSymbols(symfile, symbols);
+
+        vector<unsigned char> y9 = ReadFile(basedir + "/overarm9.bin");
+        PatchBuilder builder(y9, symbols);
+        for (int kind = 0; kind < NUM_PATCH_KINDS; kind++) {
+            PatchList list = PatchList::Read(listdir + "/" + sListNames[kind]);
+            for (const auto &line : list.lines) {
+                builder.Add((PatchKind)kind, list, line);
+            }
+        }
+
+        // Group the patches by file, keeping list order within each file.
+        map<string, TargetFile> filemap;
+        for (const auto &patch : builder.patches) {
+            TargetFile &file = filemap[patch.target];
+            if (file.path.empty()) {
+                file.path = patch.target == "arm9" ? basedir + "/arm9.bin"
+                                                   : basedir + "/overlay/overlay_" + patch.target + ".bin";
+            }
+            file.patches.push_back(&patch);
+        }
+        vector<const TargetFile *> files;
+        size_t overlaps = 0;
+        for (const auto &entry : filemap) {
+            files.push_back(&entry.second);
+            overlaps += ReportOverlaps(entry.second.path, entry.second.patches);
+        }
+        if (overlaps != 0 && werror) {
+            throw runtime_error(to_string(overlaps) + " overlapping patches");
+        }
+
+        // Each file is read, patched and written back once, by one worker.
+        atomic<size_t> nextFile{0};
+        mutex errorLock;
+        string error;
+        auto worker = [&]() {
+            for (size_t i = nextFile++; i < files.size(); i = nextFile++) {
+                try {
+                    ApplyPatches(*files[i]);
+                } catch (const exception &e) {
+                    lock_guard<mutex> guard(errorLock);
+                    if (error.empty()) {
+                        error = e.what();
+                    }
+                }
+            }
+        };
+        vector<thread> threads;
+        for (unsigned i = 1; i < min<size_t>(numThreads, files.size()); i++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto &t : threads) {
+            t.join();
+        }
+        if (!error.empty()) {
+            throw runtime_error(error);
+        }
+        return 0;
+    } catch (const command_error &e) {
+        usage();
+        cerr << e.what() << endl;
+        return 1;
+    } catch (const elf_exception &e) {
+        cerr << e.what() << endl;
+        return 1;
+    } catch (const exception &e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+}